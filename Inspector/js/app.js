@@ -15,13 +15,12 @@ import Screen from 'js/screen';
 import ScreenshotFactory from 'js/screenshot_factory';
 import Tree from 'js/tree';
 import TreeNode from 'js/tree_node';
-import TreeContext from 'js/tree_context';
 import Inspector from 'js/inspector';
 
 require('css/app.css');
 
 const SCREENSHOT_ENDPOINT = 'screenshot';
-const TREE_ENDPOINT = 'source?format=json';
+const TREE_ENDPOINT = 'source?format=json&since=';
 const ORIENTATION_ENDPOINT = 'orientation';
 
 class App extends React.Component {
@@ -54,14 +53,44 @@ class App extends React.Component {
   }
 
   fetchTree() {
-    HTTP.get(TREE_ENDPOINT, (treeInfo) => {
-      treeInfo = treeInfo.value;
-      this.setState({
-        rootNode: TreeNode.buildNode(treeInfo, new TreeContext()),
-      });
+    // Only the changes since the last received revision are transferred
+    const revision = this.currentTreeRevision();
+    HTTP.get(TREE_ENDPOINT + encodeURIComponent(revision), (treeChanges) => {
+      treeChanges = treeChanges.value;
+      if (revision !== this.currentTreeRevision()) {
+        // Another response has been applied while this one was in flight,
+        // so the changes are calculated against an outdated revision
+        this.fetchTree();
+        return;
+      }
+      if (treeChanges.tree != null) {
+        this.treeRevision = treeChanges.revision;
+        this.setState({
+          rootNode: TreeNode.buildNode(treeChanges.tree),
+        });
+        return;
+      }
+      if (treeChanges.base !== revision) {
+        // Patches can only be applied to the revision they were calculated for
+        this.treeRevision = null;
+        this.fetchTree();
+        return;
+      }
+      this.treeRevision = treeChanges.revision;
+      if (treeChanges.patches.length > 0) {
+        this.setState((state) => {
+          return {
+            rootNode: TreeNode.applyPatches(state.rootNode, treeChanges.patches),
+          };
+        });
+      }
     });
   }
 
+  currentTreeRevision() {
+    return this.treeRevision != null ? this.treeRevision : '';
+  }
+
   render() {
     return (
       <div id="app">
@@ -9,19 +9,76 @@
 
 import PropTypes from 'prop-types';
 import React from 'react';
-import TreeView from 'react-treeview';
 
 import classNames from 'classnames';
 
 require('css/tree.css');
-require('react-treeview/react-treeview.css');
 
 const CAPTION_HEIGHT = 100;
 const CAPTION_PADDING = 20;
+const TREE_HEADER_HEIGHT = 25;
+const ROW_HEIGHT = 20;
+const INDENT_WIDTH = 15;
+const OVERSCAN_ROWS = 10;
+const DEFAULT_EXPANDED_DEPTH = 6;
 
 class Tree extends React.Component {
+  constructor(props) {
+    super(props);
+    this.state = {
+      scrollTop: 0,
+      expandedOverrides: {},
+    };
+  }
+
+  componentWillReceiveProps(nextProps) {
+    if (nextProps.rootNode === this.props.rootNode) {
+      return;
+    }
+    // Keys are index paths, so overrides of replaced subtrees would apply to different nodes
+    const replacedKeys = [];
+    Tree.collectReplacedKeys(this.props.rootNode, nextProps.rootNode, replacedKeys);
+    if (replacedKeys.length === 0) {
+      return;
+    }
+    // The root key is the prefix of all other keys, while child keys are separated by slashes
+    const replacedPrefixes = replacedKeys.map((replacedKey) => {
+      return replacedKey === nextProps.rootNode.key ? replacedKey : replacedKey + '/';
+    });
+    const expandedOverrides = {};
+    Object.keys(this.state.expandedOverrides).forEach((key) => {
+      const isReplaced = replacedKeys.some((replacedKey, index) => {
+        return key === replacedKey || key.indexOf(replacedPrefixes[index]) === 0;
+      });
+      if (!isReplaced) {
+        expandedOverrides[key] = this.state.expandedOverrides[key];
+      }
+    });
+    this.setState({
+      expandedOverrides: expandedOverrides,
+    });
+  }
+
+  static collectReplacedKeys(oldNode, newNode, replacedKeys) {
+    if (oldNode == null || newNode == null || oldNode === newNode) {
+      return;
+    }
+    // Nodes along patched paths are copied together with their attributes,
+    // while replaced subtrees are built from scratch
+    if (oldNode.attributes !== newNode.attributes) {
+      replacedKeys.push(newNode.key);
+      return;
+    }
+    if (oldNode.children == null || newNode.children == null) {
+      return;
+    }
+    newNode.children.forEach((child, index) => {
+      Tree.collectReplacedKeys(oldNode.children[index], child, replacedKeys);
+    });
+  }
+
   render() {
-    const style = this.styleWithMaxHeight(
+    const style = this.styleWithHeight(
       this.maxTreeHeight());
     return (
       <div id="tree" className="section second">
@@ -30,7 +87,10 @@ class Tree extends React.Component {
         </div>
         <div className="section-content-container">
           <div className="section-content">
-            <div className="tree-container" style={style}>
+            <div
+              className="tree-container"
+              style={style}
+              onScroll={(event) => this.onScroll(event)}>
               {this.renderTree()}
             </div>
           </div>
@@ -43,9 +103,9 @@ class Tree extends React.Component {
     return window.innerHeight - CAPTION_HEIGHT + CAPTION_PADDING;
   }
 
-  styleWithMaxHeight(height) {
+  styleWithHeight(height) {
     return {
-      'maxHeight': height,
+      'height': height,
     };
   }
 
@@ -53,15 +113,64 @@ class Tree extends React.Component {
     if (this.props.rootNode == null) {
       return null;
     }
+    // Only the rows inside the visible part of the container are rendered
+    const rows = this.visibleRows();
+    const scrollTop = Math.max(0, this.state.scrollTop - TREE_HEADER_HEIGHT);
+    const firstRow = Math.max(0, Math.floor(scrollTop / ROW_HEIGHT) - OVERSCAN_ROWS);
+    const lastRow = Math.min(rows.length,
+      Math.ceil((scrollTop + this.maxTreeHeight()) / ROW_HEIGHT) + OVERSCAN_ROWS);
+    const rowsStyle = {
+      'height': rows.length * ROW_HEIGHT,
+    };
     return (
       <div>
         <div className="tree-header"/>
-        {this.renderNode(this.props.rootNode)}
+        <div className="tree-rows" style={rowsStyle}>
+          {rows.slice(firstRow, lastRow).map((row, index) => {
+            return this.renderRow(row, firstRow + index);
+          })}
+        </div>
       </div>
     );
   }
 
-  renderNode(node) {
+  visibleRows() {
+    const rootNode = this.props.rootNode;
+    const expandedOverrides = this.state.expandedOverrides;
+    if (this.rowsCache != null
+      && this.rowsCache.rootNode === rootNode
+      && this.rowsCache.expandedOverrides === expandedOverrides) {
+      return this.rowsCache.rows;
+    }
+    // Collapsed subtrees are not visited at all
+    const rows = [];
+    const visitNode = (node, depth) => {
+      const isExpanded = this.isNodeExpanded(node, depth);
+      rows.push({
+        node: node,
+        depth: depth,
+        isExpanded: isExpanded,
+      });
+      if (isExpanded && node.children != null) {
+        node.children.forEach((child) => visitNode(child, depth + 1));
+      }
+    };
+    visitNode(rootNode, 0);
+    this.rowsCache = {
+      rootNode: rootNode,
+      expandedOverrides: expandedOverrides,
+      rows: rows,
+    };
+    return rows;
+  }
+
+  isNodeExpanded(node, depth) {
+    const override = this.state.expandedOverrides[node.key];
+    return override != null ? override : depth < DEFAULT_EXPANDED_DEPTH;
+  }
+
+  renderRow(row, index) {
+    const node = row.node;
     const isSelected = (this.props.selectedNode != null
       && this.props.selectedNode.key === node.key);
     const className = classNames(
@@ -70,34 +179,59 @@ class Tree extends React.Component {
         'selected' : isSelected,
       }
     );
+    const style = {
+      'top': index * ROW_HEIGHT,
+      'height': ROW_HEIGHT,
+      'lineHeight': ROW_HEIGHT + 'px',
+      'paddingLeft': row.depth * INDENT_WIDTH,
+    };
 
-    const nodeLabelView = (
-      <span
-        className={className}
-        onClick={(event) => this.onNodeClick(node)}
-        onMouseEnter={(event) => this.onNodeMouseEnter(node)}
-        onMouseLeave={(event) => this.onNodeMouseLeave(node)}>
-        {node.name}
-      </span>
+    return (
+      <div key={node.key} className="tree-row" style={style}>
+        {this.renderArrow(row)}
+        <span
+          className={className}
+          onClick={(event) => this.onNodeClick(node)}
+          onMouseEnter={(event) => this.onNodeMouseEnter(node)}
+          onMouseLeave={(event) => this.onNodeMouseLeave(node)}>
+          {node.name}
+        </span>
+      </div>
     );
+  }
 
-    var childrenViews = null;
-    if (node.children != null) {
-      childrenViews = node.children.map((child) => {
-        return this.renderNode(child);
-      });
+  renderArrow(row) {
+    if (row.node.children == null) {
+      return <span className="tree-arrow"/>;
     }
-
+    const className = classNames(
+      'tree-arrow',
+      'expandable',
+      {
+        'collapsed' : !row.isExpanded,
+      }
+    );
     return (
-      <TreeView
-        key={node.key}
-        nodeLabel={nodeLabelView}
-        defaultCollapsed={false}>
-        {childrenViews}
-      </TreeView>
+      <span
+        className={className}
+        onClick={(event) => this.onArrowClick(row)}/>
     );
   }
 
+  onScroll(event) {
+    this.setState({
+      scrollTop: event.target.scrollTop,
+    });
+  }
+
+  onArrowClick(row) {
+    const expandedOverrides = Object.assign({}, this.state.expandedOverrides);
+    expandedOverrides[row.node.key] = !row.isExpanded;
+    this.setState({
+      expandedOverrides: expandedOverrides,
+    });
+  }
+
   onNodeClick(node) {
     if (this.props.onSelectedNodeChange != null) {
       this.props.onSelectedNodeChange(node);
@@ -8,13 +8,18 @@
  */
 
 class TreeNode {
-  static buildNode(node, context) {
-    const key = context.buildUniqueNodeKey();
+  static buildNode(node, path = []) {
+    const key = TreeNode.buildKey(path);
     const name = TreeNode.buildFullName(node);
-    const children = TreeNode.buildChildren(node, context);
+    const children = TreeNode.buildChildren(node, path);
     return new TreeNode(key, name, children, node);
   }
 
+  static buildKey(path) {
+    // Keys are index paths, so they stay the same for unchanged nodes between refreshes
+    return 'node:' + path.join('/');
+  }
+
   static buildFullName(node) {
     var fullName = '[' + node.type + ']';
     if (node.name != null) {
@@ -23,11 +28,11 @@ class TreeNode {
     return fullName;
   }
 
-  static buildChildren(node, context) {
+  static buildChildren(node, path) {
     var children = null;
     if (node.children != null) {
-      children = node.children.map((child) => {
-        return TreeNode.buildNode(child, context);
+      children = node.children.map((child, index) => {
+        return TreeNode.buildNode(child, path.concat([index]));
       });
     }
     return children;
@@ -46,6 +51,23 @@ class TreeNode {
     };
   }
 
+  static applyPatches(rootNode, patches) {
+    // Only the nodes along the patched paths are copied, all other subtrees are shared
+    return patches.reduce((node, patch) => {
+      return TreeNode.replaceNode(node, patch.path, 0, TreeNode.buildNode(patch.node, patch.path));
+    }, rootNode);
+  }
+
+  static replaceNode(node, path, depth, replacement) {
+    if (depth === path.length) {
+      return replacement;
+    }
+    const children = node.children.slice();
+    const index = path[depth];
+    children[index] = TreeNode.replaceNode(children[index], path, depth + 1, replacement);
+    return node.withChildren(children);
+  }
+
   constructor(key, name, children, node) {
     this.key = key;
     this.name = name;
@@ -62,6 +84,13 @@ class TreeNode {
       isVisible: node.isVisible,
     };
   }
+
+  withChildren(children) {
+    const node = Object.create(TreeNode.prototype);
+    Object.assign(node, this);
+    node.children = children;
+    return node;
+  }
 }
 
 module.exports = TreeNode;
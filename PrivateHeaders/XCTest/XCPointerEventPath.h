@@ -29,6 +29,9 @@
 - (void)pressDownAtOffset:(double)arg1;
 - (id)initForMouseAtPoint:(struct CGPoint)arg1 offset:(double)arg2;
 - (id)initForTouchAtPoint:(CGPoint)arg1 offset:(double)arg2;
+// Since Xcode 10
+- (id)initForTextInput;
+- (void)typeText:(NSString *)arg1 atOffset:(double)arg2 typingSpeed:(unsigned long long)arg3 shouldRedact:(BOOL)arg4;
 - (id)init;
 
 @end
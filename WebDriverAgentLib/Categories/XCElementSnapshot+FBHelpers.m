@@ -13,6 +13,7 @@
 #import "FBXPathCreator.h"
 #import "FBRunLoopSpinner.h"
 #import "FBLogger.h"
+#import "FBTrace.h"
 #import "XCAXClient_iOS.h"
 #import "XCTestDriver.h"
 #import "XCTestPrivateSymbols.h"
@@ -59,7 +60,9 @@ inline static BOOL isSnapshotTypeAmongstGivenTypes(XCElementSnapshot* snapshot,
 
 - (id)fb_attributeValue:(NSNumber *)attribute
 {
+  FBTraceBegin("XCAXClient_iOS attributesForElementSnapshot");
   NSDictionary *attributesResult = [[XCAXClient_iOS sharedClient] attributesForElementSnapshot:self attributeList:@[attribute]];
+  FBTraceEnd("XCAXClient_iOS attributesForElementSnapshot");
   return (id __nonnull)attributesResult[attribute];
 }
 
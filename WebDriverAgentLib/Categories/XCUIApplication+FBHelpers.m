@@ -11,9 +11,13 @@
 
 #import "FBSpringboardApplication.h"
 #import "XCElementSnapshot.h"
+#import "FBConfiguration.h"
 #import "FBElementTypeTransformer.h"
 #import "FBMacros.h"
+#import "FBTrace.h"
 #import "FBXCodeCompatibility.h"
+#import "XCAXClient_iOS.h"
+#import "XCTestPrivateSymbols.h"
 #import "XCElementSnapshot+FBHelpers.h"
 #import "XCUIDevice+FBHelpers.h"
 #import "XCUIElement+FBIsVisible.h"
@@ -33,6 +37,7 @@ const static NSTimeInterval FBMinimumAppSwitchWait = 3.0;
   [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:MAX(duration, FBMinimumAppSwitchWait)]];
   if (self.fb_isActivateSupported) {
     [self fb_activate];
+    [FBApplication fb_invalidateActiveApplication];
     return YES;
   }
   return [[FBSpringboardApplication fb_springboard] fb_tapApplicationWithIdentifier:applicationIdentifier error:error];
@@ -48,7 +53,8 @@ const static NSTimeInterval FBMinimumAppSwitchWait = 3.0;
 {
   [self fb_waitUntilSnapshotIsStable];
   // We ignore all elements except for the main window for accessibility tree
-  return [self.class accessibilityInfoForElement:self.fb_lastSnapshot];
+  NSMapTable<XCElementSnapshot *, NSDictionary *> *attributesCache = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality valueOptions:NSPointerFunctionsStrongMemory];
+  return [self.class accessibilityInfoForElement:self.fb_lastSnapshot insideAccessibleElement:NO attributesCache:attributesCache];
 }
 
 + (NSDictionary *)dictionaryForElement:(XCElementSnapshot *)snapshot
@@ -84,22 +90,31 @@ const static NSTimeInterval FBMinimumAppSwitchWait = 3.0;
   };
 }
 
-+ (NSDictionary *)accessibilityInfoForElement:(XCElementSnapshot *)snapshot
+/**
+ Walks the tree top-down, so that ancestors accessibility is carried over to descendants
+ instead of being fetched again for each of them. This keeps the count of remote attribute
+ requests linear to the count of snapshots. The logic mirrors isWDAccessible and isWDVisible.
+ */
++ (NSDictionary *)accessibilityInfoForElement:(XCElementSnapshot *)snapshot insideAccessibleElement:(BOOL)insideAccessibleElement attributesCache:(NSMapTable<XCElementSnapshot *, NSDictionary *> *)attributesCache
 {
-  BOOL isAccessible = [snapshot isWDAccessible];
-  BOOL isVisible = [snapshot isWDVisible];
+  // Descendants of accessibility elements are never accessible, so their attributes are not even fetched
+  BOOL isAccessibilityElement = !insideAccessibleElement && [self isAccessibilityElement:snapshot attributesCache:attributesCache];
+  BOOL isAccessible = !insideAccessibleElement && [self isAccessible:snapshot isAccessibilityElement:isAccessibilityElement attributesCache:attributesCache];
 
   NSMutableDictionary *info = [[NSMutableDictionary alloc] init];
 
   if (isAccessible) {
-    if (isVisible) {
+    if ([self isVisible:snapshot attributesCache:attributesCache]) {
       info[@"value"] = FBValueOrNull(snapshot.wdValue);
       info[@"label"] = FBValueOrNull(snapshot.wdLabel);
     }
   } else {
+    // Table views are skipped in ancestors checks, since they might be marked as accessibility elements
+    // if they provide Search results controller, even though they are not
+    BOOL isChildInsideAccessibleElement = insideAccessibleElement || (isAccessibilityElement && snapshot.elementType != XCUIElementTypeTable);
     NSMutableArray *children = [[NSMutableArray alloc] init];
     for (XCElementSnapshot *childSnapshot in snapshot.children) {
-      NSDictionary *childInfo = [self accessibilityInfoForElement:childSnapshot];
+      NSDictionary *childInfo = [self accessibilityInfoForElement:childSnapshot insideAccessibleElement:isChildInsideAccessibleElement attributesCache:attributesCache];
       if ([childInfo count]) {
         [children addObject: childInfo];
       }
@@ -118,4 +133,54 @@ const static NSTimeInterval FBMinimumAppSwitchWait = 3.0;
   return info;
 }
 
++ (BOOL)isAccessible:(XCElementSnapshot *)snapshot isAccessibilityElement:(BOOL)isAccessibilityElement attributesCache:(NSMapTable<XCElementSnapshot *, NSDictionary *> *)attributesCache
+{
+  // Special cases:
+  // Table view cell: we consider it accessible if it's container is accessible
+  // Text fields: actual accessible element isn't text field itself, but nested element
+  if (snapshot.elementType == XCUIElementTypeCell) {
+    XCElementSnapshot *containerView = [[snapshot children] firstObject];
+    return isAccessibilityElement || (nil != containerView && [self isAccessibilityElement:containerView attributesCache:attributesCache]);
+  }
+  if (snapshot.elementType == XCUIElementTypeTextField || snapshot.elementType == XCUIElementTypeSecureTextField) {
+    return YES;
+  }
+  return isAccessibilityElement;
+}
+
++ (BOOL)isAccessibilityElement:(XCElementSnapshot *)snapshot attributesCache:(NSMapTable<XCElementSnapshot *, NSDictionary *> *)attributesCache
+{
+  return [(NSNumber *)[self accessibilityAttributesOfSnapshot:snapshot attributesCache:attributesCache][FB_XCAXAIsElementAttribute] boolValue];
+}
+
++ (BOOL)isVisible:(XCElementSnapshot *)snapshot attributesCache:(NSMapTable<XCElementSnapshot *, NSDictionary *> *)attributesCache
+{
+  if (![FBConfiguration shouldUseTestManagerForVisibilityDetection]) {
+    return snapshot.isWDVisible;
+  }
+  if (CGRectIsEmpty(snapshot.frame)) {
+    return NO;
+  }
+  return [(NSNumber *)[self accessibilityAttributesOfSnapshot:snapshot attributesCache:attributesCache][FB_XCAXAIsVisibleAttribute] boolValue];
+}
+
+/**
+ Fetches all the attributes needed for the accessibility tree of the snapshot in a single request
+ */
++ (NSDictionary *)accessibilityAttributesOfSnapshot:(XCElementSnapshot *)snapshot attributesCache:(NSMapTable<XCElementSnapshot *, NSDictionary *> *)attributesCache
+{
+  NSDictionary *attributes = [attributesCache objectForKey:snapshot];
+  if (nil != attributes) {
+    return attributes;
+  }
+  NSArray<NSNumber *> *attributeList = [FBConfiguration shouldUseTestManagerForVisibilityDetection]
+    ? @[FB_XCAXAIsElementAttribute, FB_XCAXAIsVisibleAttribute]
+    : @[FB_XCAXAIsElementAttribute];
+  FBTraceBegin("XCAXClient_iOS attributesForElementSnapshot");
+  attributes = [[XCAXClient_iOS sharedClient] attributesForElementSnapshot:snapshot attributeList:attributeList] ?: @{};
+  FBTraceEnd("XCAXClient_iOS attributesForElementSnapshot");
+  [attributesCache setObject:attributes forKey:snapshot];
+  return attributes;
+}
+
 @end
@@ -36,6 +36,13 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (nullable NSData *)fb_screenshotWithError:(NSError*__autoreleasing*)error;
 
+/**
+ Returns screenshot in the format it has been provided by XCTest (JPEG since Xcode 9) without re-encoding it
+ @param error If there is an error, upon return contains an NSError object that describes the problem.
+ @return Device screenshot data or nil in case of failure. Use FBImageMimeType to get its format
+ */
+- (nullable NSData *)fb_rawScreenshotWithError:(NSError*__autoreleasing*)error;
+
 /**
  Returns device current wifi ip4 address
  */
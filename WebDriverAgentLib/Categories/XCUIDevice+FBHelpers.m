@@ -16,10 +16,12 @@
 
 #import "FBSpringboardApplication.h"
 #import "FBErrorBuilder.h"
+#import "FBImageUtils.h"
 #import "FBMathUtils.h"
 #import "FBXCodeCompatibility.h"
 
 #import "FBMacros.h"
+#import "FBTrace.h"
 #import "XCAXClient_iOS.h"
 #import "XCUIScreen.h"
 
@@ -30,6 +32,7 @@ static const NSTimeInterval FBHomeButtonCoolOffTime = 1.;
 - (BOOL)fb_goToHomescreenWithError:(NSError **)error
 {
   [self pressButton:XCUIDeviceButtonHome];
+  [FBApplication fb_invalidateActiveApplication];
   // This is terrible workaround to the fact that pressButton:XCUIDeviceButtonHome is not a synchronous action.
   // On 9.2 some first queries  will trigger additional "go to home" event
   // So if we don't wait here it will be interpreted as double home button gesture and go to application switcher instead.
@@ -43,10 +46,21 @@ static const NSTimeInterval FBHomeButtonCoolOffTime = 1.;
 }
 
 - (NSData *)fb_screenshotWithError:(NSError*__autoreleasing*)error
+{
+  NSData *result = [self fb_rawScreenshotWithError:error];
+  if (nil == result) {
+    return nil;
+  }
+  return FBToPngData(result);
+}
+
+- (NSData *)fb_rawScreenshotWithError:(NSError*__autoreleasing*)error
 {
   Class xcScreenClass = objc_lookUpClass("XCUIScreen");
   if (nil == xcScreenClass) {
+    FBTraceBegin("XCAXClient_iOS screenshotData");
     NSData *result = [[XCAXClient_iOS sharedClient] screenshotData];
+    FBTraceEnd("XCAXClient_iOS screenshotData");
     if (nil == result) {
       if (error) {
         *error = [[FBErrorBuilder.builder withDescription:@"Cannot take a screenshot of the current screen state"] build];
@@ -65,14 +79,7 @@ static const NSTimeInterval FBHomeButtonCoolOffTime = 1.;
   CGRect screenRect = CGRectMake(0, 0, screenSize.width, screenSize.height);
 
   XCUIScreen *mainScreen = (XCUIScreen *)[xcScreenClass mainScreen];
-  NSData *result = [mainScreen screenshotDataForQuality:quality rect:screenRect error:error];
-  if (nil == result) {
-    return nil;
-  }
-
-  // The resulting data is a JPEG image, so we need to convert it to PNG representation
-  UIImage *image = [UIImage imageWithData:result];
-  return (NSData *)UIImagePNGRepresentation(image);
+  return [mainScreen screenshotDataForQuality:quality rect:screenRect error:error];
 }
 
 - (BOOL)fb_fingerTouchShouldMatch:(BOOL)shouldMatch
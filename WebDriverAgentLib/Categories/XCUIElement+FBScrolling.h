@@ -50,6 +50,17 @@ typedef NS_ENUM(NSUInteger, FBXCUIElementScrollDirection) {
  */
 - (void)fb_scrollRightByNormalizedDistance:(CGFloat)distance;
 
+/**
+ Scrolls receiver by the given normalized vector. Scrolls longer than the receiver's frame are split
+ into several touch paths, which are all delivered to the test manager as a single synthesized event.
+
+ @param normalizedVector Normalized <-1.0 - 1.0> scroll vector. Positive values scroll up/left
+ @param duration Total duration of the scroll gesture in seconds. Zero means the default scroll velocity is used
+ @param error If there is an error, upon return contains an NSError object that describes the problem.
+ @return YES if the operation succeeds, otherwise NO.
+ */
+- (BOOL)fb_scrollByNormalizedVector:(CGVector)normalizedVector duration:(NSTimeInterval)duration error:(NSError **)error;
+
 /**
  Scrolls parent scroll view till receiver is visible.
 
@@ -37,6 +37,7 @@ const CGFloat FBScrollBoundingVelocityPadding = 0.0f;
 const CGFloat FBScrollTouchProportion = 0.75f;
 const CGFloat FBScrollCoolOffTime = 1.f;
 const CGFloat FBMinimumTouchEventDelay = 0.1f;
+const CGFloat FBScrollInitialDelay = 0.3f; // Waiting before scrolling helps to make it more stable
 
 @interface XCElementSnapshot (FBScrolling)
 
@@ -45,6 +46,7 @@ const CGFloat FBMinimumTouchEventDelay = 0.1f;
 - (void)fb_scrollLeftByNormalizedDistance:(CGFloat)distance inApplication:(XCUIApplication *)application;
 - (void)fb_scrollRightByNormalizedDistance:(CGFloat)distance inApplication:(XCUIApplication *)application;
 - (BOOL)fb_scrollByNormalizedVector:(CGVector)normalizedScrollVector inApplication:(XCUIApplication *)application;
+- (BOOL)fb_scrollByNormalizedVector:(CGVector)normalizedScrollVector inApplication:(XCUIApplication *)application duration:(NSTimeInterval)duration error:(NSError **)error;
 - (BOOL)fb_scrollByVector:(CGVector)vector inApplication:(XCUIApplication *)application error:(NSError **)error;
 
 @end
@@ -71,6 +73,11 @@ const CGFloat FBMinimumTouchEventDelay = 0.1f;
   [self.fb_lastSnapshot fb_scrollRightByNormalizedDistance:distance inApplication:self.application];
 }
 
+- (BOOL)fb_scrollByNormalizedVector:(CGVector)normalizedVector duration:(NSTimeInterval)duration error:(NSError **)error
+{
+  return [self.fb_lastSnapshot fb_scrollByNormalizedVector:normalizedVector inApplication:self.application duration:duration error:error];
+}
+
 - (BOOL)fb_scrollToVisibleWithError:(NSError **)error
 {
   return [self fb_scrollToVisibleWithNormalizedScrollDistance:FBScrollToVisibleNormalizedDistance error:error];
@@ -85,7 +92,7 @@ const CGFloat FBMinimumTouchEventDelay = 0.1f;
 
 - (BOOL)fb_scrollToVisibleWithNormalizedScrollDistance:(CGFloat)normalizedScrollDistance scrollDirection:(FBXCUIElementScrollDirection)scrollDirection error:(NSError **)error
 {
-  [self resolve];
+  [self fb_resolve];
   if (self.fb_isVisible) {
     return YES;
   }
@@ -163,7 +170,7 @@ const CGFloat FBMinimumTouchEventDelay = 0.1f;
         [scrollView fb_scrollDownByNormalizedDistance:normalizedScrollDistance inApplication:self.application] :
         [scrollView fb_scrollRightByNormalizedDistance:normalizedScrollDistance inApplication:self.application];
     }
-    [self resolve]; // Resolve is needed for correct visibility
+    [self fb_resolve]; // Resolve is needed for correct visibility
     scrollCount++;
   }
 
@@ -230,14 +237,24 @@ const CGFloat FBMinimumTouchEventDelay = 0.1f;
 }
 
 - (BOOL)fb_scrollByNormalizedVector:(CGVector)normalizedScrollVector inApplication:(XCUIApplication *)application
+{
+  return [self fb_scrollByNormalizedVector:normalizedScrollVector inApplication:application duration:0 error:nil];
+}
+
+- (BOOL)fb_scrollByNormalizedVector:(CGVector)normalizedScrollVector inApplication:(XCUIApplication *)application duration:(NSTimeInterval)duration error:(NSError **)error
 {
   CGVector scrollVector = CGVectorMake(CGRectGetWidth(self.scrollingFrame) * normalizedScrollVector.dx,
                                        CGRectGetHeight(self.scrollingFrame) * normalizedScrollVector.dy
                                        );
-  return [self fb_scrollByVector:scrollVector inApplication:application error:nil];
+  return [self fb_scrollByVector:scrollVector inApplication:application duration:duration error:error];
 }
 
 - (BOOL)fb_scrollByVector:(CGVector)vector inApplication:(XCUIApplication *)application error:(NSError **)error
+{
+  return [self fb_scrollByVector:vector inApplication:application duration:0 error:error];
+}
+
+- (BOOL)fb_scrollByVector:(CGVector)vector inApplication:(XCUIApplication *)application duration:(NSTimeInterval)duration error:(NSError **)error
 {
   CGVector scrollBoundingVector = CGVectorMake(CGRectGetWidth(self.scrollingFrame) * FBScrollTouchProportion - FBScrollBoundingVelocityPadding,
                                                CGRectGetHeight(self.scrollingFrame)* FBScrollTouchProportion - FBScrollBoundingVelocityPadding
@@ -245,6 +262,9 @@ const CGFloat FBMinimumTouchEventDelay = 0.1f;
   scrollBoundingVector.dx = (CGFloat)floor(copysign(scrollBoundingVector.dx, vector.dx));
   scrollBoundingVector.dy = (CGFloat)floor(copysign(scrollBoundingVector.dy, vector.dy));
 
+  // Long scrolls are split into segments, which fit into the scroll view frame
+  NSMutableArray<NSValue *> *segments = [NSMutableArray array];
+  CGFloat totalLength = 0;
   NSUInteger scrollLimit = 100;
   BOOL shouldFinishScrolling = NO;
   while (!shouldFinishScrolling) {
@@ -253,11 +273,28 @@ const CGFloat FBMinimumTouchEventDelay = 0.1f;
     scrollVector.dy = fabs(vector.dy) > fabs(scrollBoundingVector.dy) ? scrollBoundingVector.dy : vector.dy;
     vector = CGVectorMake(vector.dx - scrollVector.dx, vector.dy - scrollVector.dy);
     shouldFinishScrolling = (vector.dx == 0.0 & vector.dy == 0.0 || --scrollLimit == 0);
-    if (![self fb_scrollAncestorScrollViewByVectorWithinScrollViewFrame:scrollVector inApplication:application error:error]){
-      return NO;
+    [segments addObject:[NSValue valueWithCGVector:scrollVector]];
+    totalLength += MAX(fabs(scrollVector.dx), fabs(scrollVector.dy));
+  }
+
+  // All segments are sent to the daemon as a single event, so the scroll costs one round trip
+  XCSynthesizedEventRecord *event = [[XCSynthesizedEventRecord alloc] initWithName:@"FBScroll" interfaceOrientation:application.interfaceOrientation];
+  CGFloat offset = FBScrollInitialDelay;
+  for (NSValue *segment in segments) {
+    CGVector scrollVector = segment.CGVectorValue;
+    CGFloat segmentLength = MAX(fabs(scrollVector.dx), fabs(scrollVector.dy));
+    double scrollingTime = (duration > 0 && totalLength > 0) ? duration * segmentLength / totalLength : segmentLength / FBScrollVelocity;
+    XCPointerEventPath *touchPath = [self fb_touchPathForScrollingVector:scrollVector inApplication:application offset:offset duration:scrollingTime];
+    if (nil == touchPath) {
+      continue;
     }
+    [event addPointerEventPath:touchPath];
+    offset = (CGFloat)event.maximumOffset + FBMinimumTouchEventDelay;
   }
-  return YES;
+  if (0 == event.eventPaths.count) {
+    return YES;
+  }
+  return [self fb_synthesizeScrollEvent:event error:error];
 }
 
 - (CGVector)fb_hitPointOffsetForScrollingVector:(CGVector)scrollingVector
@@ -267,7 +304,7 @@ const CGFloat FBMinimumTouchEventDelay = 0.1f;
   return CGVectorMake((CGFloat)floor(x), (CGFloat)floor(y));
 }
 
-- (BOOL)fb_scrollAncestorScrollViewByVectorWithinScrollViewFrame:(CGVector)vector inApplication:(XCUIApplication *)application error:(NSError **)error
+- (XCPointerEventPath *)fb_touchPathForScrollingVector:(CGVector)vector inApplication:(XCUIApplication *)application offset:(CGFloat)offset duration:(double)duration
 {
   CGVector hitpointOffset = [self fb_hitPointOffsetForScrollingVector:vector];
 
@@ -276,32 +313,20 @@ const CGFloat FBMinimumTouchEventDelay = 0.1f;
   XCUICoordinate *endCoordinate = [[XCUICoordinate alloc] initWithCoordinate:startCoordinate pointsOffset:vector];
 
   if (FBPointFuzzyEqualToPoint(startCoordinate.fb_screenPoint, endCoordinate.fb_screenPoint, FBFuzzyPointThreshold)) {
-    return YES;
+    return nil;
   }
 
-  CGFloat offset = 0.3f; // Waiting before scrolling helps to make it more stable
-  double scrollingTime = MAX(fabs(vector.dx), fabs(vector.dy))/FBScrollVelocity;
   XCPointerEventPath *touchPath = [[XCPointerEventPath alloc] initForTouchAtPoint:startCoordinate.fb_screenPoint offset:offset];
-  offset += MAX(scrollingTime, FBMinimumTouchEventDelay); // Setting Minimum scrolling time to avoid testmanager complaining about timing
+  offset += MAX(duration, FBMinimumTouchEventDelay); // Setting Minimum scrolling time to avoid testmanager complaining about timing
   [touchPath moveToPoint:endCoordinate.fb_screenPoint atOffset:offset];
   offset += FBMinimumTouchEventDelay;
   [touchPath liftUpAtOffset:offset];
+  return touchPath;
+}
 
-  XCSynthesizedEventRecord *event = [[XCSynthesizedEventRecord alloc] initWithName:@"FBScroll" interfaceOrientation:application.interfaceOrientation];
-  [event addPointerEventPath:touchPath];
-
-  __block BOOL didSucceed = NO;
-  __block NSError *innerError;
-  [FBRunLoopSpinner spinUntilCompletion:^(void(^completion)(void)){
-    [[FBXCTestDaemonsProxy testRunnerProxy] _XCT_synthesizeEvent:event completion:^(NSError *scrollingError) {
-      innerError = scrollingError;
-      didSucceed = (scrollingError == nil);
-      completion();
-    }];
-  }];
-  if (error) {
-    *error = innerError;
-  }
+- (BOOL)fb_synthesizeScrollEvent:(XCSynthesizedEventRecord *)event error:(NSError **)error
+{
+  BOOL didSucceed = [FBXCTestDaemonsProxy synthesizeEventWithRecord:event error:error];
   // Tapping cells immediately after scrolling may fail due to way UIKit is handling touches.
   // We should wait till scroll view cools off, before continuing
   [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:FBScrollCoolOffTime]];
@@ -34,6 +34,19 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (BOOL)fb_typeText:(NSString *)text frequency:(NSUInteger)frequency error:(NSError **)error;
 
+/**
+ Types a text into element after removing its current text.
+ Removal and typing are sent to the device as a single event stream.
+ It will try to activate keyboard on element, if element has no keyboard focus.
+
+ @param text text that should be typed
+ @param shouldClear whether the current text of element should be removed first
+ @param frequency Frequency of typing (letters per sec)
+ @param error If there is an error, upon return contains an NSError object that describes the problem.
+ @return YES if the operation succeeds, otherwise NO.
+ */
+- (BOOL)fb_typeText:(NSString *)text shouldClear:(BOOL)shouldClear frequency:(NSUInteger)frequency error:(NSError **)error;
+
 /**
  Clears text on element.
  It will try to activate keyboard on element, if element has no keyboard focus.
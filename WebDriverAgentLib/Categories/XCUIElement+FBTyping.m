@@ -12,9 +12,12 @@
 #import "FBConfiguration.h"
 #import "FBErrorBuilder.h"
 #import "FBKeyboard.h"
+#import "FBTypingFrequencyTuner.h"
 #import "NSString+FBVisualLength.h"
 #import "XCUIElement+FBTap.h"
 
+static NSUInteger const FBAdaptiveTypingMaxAttempts = 3;
+
 @implementation XCUIElement (FBTyping)
 
 - (BOOL)fb_typeText:(NSString *)text error:(NSError **)error
@@ -24,16 +27,106 @@
 
 - (BOOL)fb_typeText:(NSString *)text frequency:(NSUInteger)frequency error:(NSError **)error
 {
-  if (!self.hasKeyboardFocus && ![self fb_tapWithError:error]) {
+  if (![self fb_prepareForTypingWithError:error]) {
     return NO;
   }
+  if ([FBConfiguration shouldUseAdaptiveTypingFrequency] && [self fb_canVerifyTypedText:text]) {
+    return [self fb_typeText:text adaptivelyWithMinimumFrequency:frequency error:error];
+  }
   if (![FBKeyboard typeText:text frequency:frequency error:error]) {
     return NO;
   }
   return YES;
 }
 
+- (BOOL)fb_typeText:(NSString *)text shouldClear:(BOOL)shouldClear frequency:(NSUInteger)frequency error:(NSError **)error
+{
+  if (!shouldClear) {
+    return [self fb_typeText:text frequency:frequency error:error];
+  }
+  if (![self fb_prepareForTypingWithError:error]) {
+    return NO;
+  }
+  return [FBKeyboard clearCharactersCount:[self fb_textLength] andTypeText:text frequency:frequency error:error];
+}
+
 - (BOOL)fb_clearTextWithError:(NSError **)error
+{
+  NSUInteger textLength = [self fb_textLength];
+  if (0 == textLength) {
+    return YES;
+  }
+  if (![self fb_prepareForTypingWithError:error]) {
+    return NO;
+  }
+  if (![FBKeyboard clearCharactersCount:textLength andTypeText:@"" frequency:[FBConfiguration maxTypingFrequency] error:error]) {
+    return NO;
+  }
+  if (0 == [self fb_textLength]) {
+    return YES;
+  }
+  // Keyboard may drop some of the removal keys, so the remaining text is cleared with the slower re-measuring loop
+  return [self fb_clearTextByRemeasuringWithError:error];
+}
+
+#pragma mark - Private
+
+- (BOOL)fb_prepareForTypingWithError:(NSError **)error
+{
+  if (self.hasKeyboardFocus) {
+    return YES;
+  }
+  [FBKeyboard invalidateStableState];
+  return [self fb_tapWithError:error];
+}
+
+/**
+ Text typed into element. Placeholder value is not counted as text
+ */
+- (NSString *)fb_typedText
+{
+  NSString *value = self.value;
+  if (![value isKindOfClass:NSString.class] || [value isEqualToString:self.placeholderValue]) {
+    return @"";
+  }
+  return value;
+}
+
+- (NSUInteger)fb_textLength
+{
+  return [[self fb_typedText] fb_visualLength];
+}
+
+/**
+ Typed text can be compared with the value of element, unless the value is masked
+ or the text contains keys, which edit the value instead of appending to it
+ */
+- (BOOL)fb_canVerifyTypedText:(NSString *)text
+{
+  if (self.elementType == XCUIElementTypeSecureTextField) {
+    return NO;
+  }
+  return [text rangeOfCharacterFromSet:[NSCharacterSet controlCharacterSet]].location == NSNotFound;
+}
+
+/**
+ Types the text with the frequency learned by FBTypingFrequencyTuner and checks the value of element afterwards
+ */
+- (BOOL)fb_typeText:(NSString *)text adaptivelyWithMinimumFrequency:(NSUInteger)minimumFrequency error:(NSError **)error
+{
+  FBTypingFrequencyTunerTyper typer = ^BOOL(NSString *textToType, NSUInteger frequency, BOOL shouldReplaceValue, NSError **typingError) {
+    if (shouldReplaceValue) {
+      return [FBKeyboard clearCharactersCount:[self fb_textLength] andTypeText:textToType frequency:frequency error:typingError];
+    }
+    return [FBKeyboard typeText:textToType frequency:frequency error:typingError];
+  };
+  FBTypingFrequencyTunerTextReader textReader = ^NSString *{
+    return [self fb_typedText];
+  };
+  return [[FBTypingFrequencyTuner sharedTuner] typeText:text afterText:[self fb_typedText] minimumFrequency:minimumFrequency attempts:FBAdaptiveTypingMaxAttempts typer:typer textReader:textReader error:error];
+}
+
+- (BOOL)fb_clearTextByRemeasuringWithError:(NSError **)error
 {
   NSUInteger preClearTextLength = 0;
   NSData *encodedSequence = [@"\\u0008\\u007F" dataUsingEncoding:NSASCIIStringEncoding];
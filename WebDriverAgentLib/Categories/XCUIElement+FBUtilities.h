@@ -33,6 +33,15 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (BOOL)fb_obstructsElement:(XCUIElement *)element;
 
+/**
+ Resolves the element. Each resolution is counted in route metrics and traced,
+ so this method should be preferred over the bare -resolve call.
+ */
+- (void)fb_resolve;
+
+/*! System uptime of the last fb_resolve call or 0 if the element has never been resolved with it */
+@property (nonatomic, readonly) NSTimeInterval fb_lastResolveTimestamp;
+
 /**
  Gets the most recent snapshot of the current element. The element will be 
  automatically resolved if the snapshot is not available yet
@@ -66,6 +75,14 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (nullable NSData *)fb_screenshotWithError:(NSError **)error;
 
+/**
+ Returns screenshot of the particular element without re-encoding it if possible.
+ The screenshot is only redrawn if it has to be rotated to match the current interface orientation.
+ @param error If there is an error, upon return contains an NSError object that describes the problem.
+ @return Element screenshot data or nil in case of failure. Use FBImageMimeType to get its format
+ */
+- (nullable NSData *)fb_rawScreenshotWithError:(NSError **)error;
+
 @end
 
 NS_ASSUME_NONNULL_END
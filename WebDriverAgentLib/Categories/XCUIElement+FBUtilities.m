@@ -12,11 +12,14 @@
 #import <objc/runtime.h>
 
 #import "FBAlert.h"
+#import "FBImageUtils.h"
 #import "FBLogger.h"
 #import "FBMacros.h"
 #import "FBMathUtils.h"
 #import "FBPredicate.h"
+#import "FBRouteMetrics.h"
 #import "FBRunLoopSpinner.h"
+#import "FBTrace.h"
 #import "FBXCodeCompatibility.h"
 #import "XCAXClient_iOS.h"
 #import "XCUIElement+FBWebDriverAttributes.h"
@@ -36,7 +39,7 @@ static const NSTimeInterval FBANIMATION_TIMEOUT = 5.0;
   [[[FBRunLoopSpinner new]
      timeout:10.]
    spinUntilTrue:^BOOL{
-     [self resolve];
+     [self fb_resolve];
      const BOOL isSameFrame = FBRectFuzzyEqualToRect(self.wdFrame, frame, FBDefaultFrameFuzzyThreshold);
      frame = self.wdFrame;
      return isSameFrame;
@@ -64,9 +67,23 @@ static const NSTimeInterval FBANIMATION_TIMEOUT = 5.0;
   return YES;
 }
 
-- (XCElementSnapshot *)fb_lastSnapshot
+- (void)fb_resolve
 {
+  FBTraceBegin("XCUIElement resolve");
   [self resolve];
+  FBTraceEnd("XCUIElement resolve");
+  FBRouteMetricsCountResolve();
+  objc_setAssociatedObject(self, @selector(fb_lastResolveTimestamp), @([NSProcessInfo processInfo].systemUptime), OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+}
+
+- (NSTimeInterval)fb_lastResolveTimestamp
+{
+  return [objc_getAssociatedObject(self, @selector(fb_lastResolveTimestamp)) doubleValue];
+}
+
+- (XCElementSnapshot *)fb_lastSnapshot
+{
+  [self fb_resolve];
   return [[self query] elementSnapshotForDebugDescription];
 }
 
@@ -118,9 +135,11 @@ static const NSTimeInterval FBANIMATION_TIMEOUT = 5.0;
 - (BOOL)fb_waitUntilSnapshotIsStable
 {
   dispatch_semaphore_t sem = dispatch_semaphore_create(0);
+  FBTraceBegin("XCAXClient_iOS notifyWhenNoAnimationsAreActiveForApplication");
   [[XCAXClient_iOS sharedClient] notifyWhenNoAnimationsAreActiveForApplication:self.application reply:^{dispatch_semaphore_signal(sem);}];
   dispatch_time_t timeout = dispatch_time(DISPATCH_TIME_NOW, (int64_t)(FBANIMATION_TIMEOUT * NSEC_PER_SEC));
   BOOL result = 0 == dispatch_semaphore_wait(sem, timeout);
+  FBTraceEnd("XCAXClient_iOS notifyWhenNoAnimationsAreActiveForApplication");
   if (!result) {
     [FBLogger logFmt:@"There are still some active animations in progress after %.2f seconds timeout. Visibility detection may cause unexpected delays.", FBANIMATION_TIMEOUT];
   }
@@ -128,6 +147,15 @@ static const NSTimeInterval FBANIMATION_TIMEOUT = 5.0;
 }
 
 - (NSData *)fb_screenshotWithError:(NSError **)error
+{
+  NSData *result = [self fb_rawScreenshotWithError:error];
+  if (nil == result) {
+    return nil;
+  }
+  return FBToPngData(result);
+}
+
+- (NSData *)fb_rawScreenshotWithError:(NSError **)error
 {
   if (CGRectIsEmpty(self.frame)) {
     if (error) {
@@ -150,7 +178,6 @@ static const NSTimeInterval FBANIMATION_TIMEOUT = 5.0;
     return nil;
   }
 
-  UIImage *image = [UIImage imageWithData:result];
   UIInterfaceOrientation orientation = self.application.interfaceOrientation;
   UIImageOrientation imageOrientation = UIImageOrientationUp;
   // The received element screenshot will be rotated, if the current interface orientation differs from portrait, so we need to fix that first
@@ -161,13 +188,16 @@ static const NSTimeInterval FBANIMATION_TIMEOUT = 5.0;
   } else if (orientation == UIInterfaceOrientationPortraitUpsideDown) {
     imageOrientation = UIImageOrientationDown;
   }
+  if (imageOrientation == UIImageOrientationUp) {
+    return result;
+  }
+  UIImage *image = [UIImage imageWithData:result];
   CGSize size = image.size;
   UIGraphicsBeginImageContext(CGSizeMake(size.width, size.height));
   [[UIImage imageWithCGImage:(CGImageRef)[image CGImage] scale:1.0 orientation:imageOrientation] drawInRect:CGRectMake(0, 0, size.width, size.height)];
   UIImage *fixedImage = UIGraphicsGetImageFromCurrentImageContext();
   UIGraphicsEndImageContext();
 
-  // The resulting data is a JPEG image, so we need to convert it to PNG representation
   return (NSData *)UIImagePNGRepresentation(fixedImage);
 }
 
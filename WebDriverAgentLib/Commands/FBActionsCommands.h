@@ -7,16 +7,14 @@
  * of patent rights can be found in the PATENTS file in the same directory.
  */
 
-class TreeContext {
-  constructor() {
-    this.baseKey = Math.random();
-    this.numberOfNodes = 0;
-  }
+#import <Foundation/Foundation.h>
 
-  buildUniqueNodeKey() {
-    this.numberOfNodes++;
-    return this.baseKey + '|' + this.numberOfNodes;
-  }
-}
+#import <WebDriverAgentLib/FBCommandHandler.h>
 
-module.exports = TreeContext;
+NS_ASSUME_NONNULL_BEGIN
+
+@interface FBActionsCommands : NSObject <FBCommandHandler>
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,58 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import "FBActionsCommands.h"
+
+#import "FBRouteRequest.h"
+#import "FBSession.h"
+#import "FBApplication.h"
+#import "FBW3CActionsSynthesizer.h"
+#import "FBXCTestDaemonsProxy.h"
+#import "XCSynthesizedEventRecord.h"
+
+@implementation FBActionsCommands
+
+#pragma mark - <FBCommandHandler>
+
++ (NSArray *)routes
+{
+  return
+  @[
+    [[FBRoute POST:@"/actions"] respondWithTarget:self action:@selector(handlePerformW3CActions:)],
+    [[FBRoute DELETE:@"/actions"] respondWithTarget:self action:@selector(handleReleaseActions:)],
+  ];
+}
+
+
+#pragma mark - Commands
+
++ (id<FBResponsePayload>)handlePerformW3CActions:(FBRouteRequest *)request
+{
+  FBSession *session = request.session;
+  FBW3CActionsSynthesizer *synthesizer = [[FBW3CActionsSynthesizer alloc] initWithActions:request.arguments[@"actions"]
+                                                                           forApplication:session.application
+                                                                             elementCache:session.elementCache];
+  NSError *error;
+  XCSynthesizedEventRecord *eventRecord = [synthesizer synthesizeWithError:&error];
+  if (nil == eventRecord) {
+    return FBResponseWithStatus(FBCommandStatusInvalidArgument, error.description);
+  }
+  if (![FBXCTestDaemonsProxy synthesizeEventWithRecord:eventRecord error:&error]) {
+    return FBResponseWithError(error);
+  }
+  return FBResponseWithOK();
+}
+
++ (id<FBResponsePayload>)handleReleaseActions:(FBRouteRequest *)request
+{
+  // All touches are finished within a single synthesized event, so there is no input state to release
+  return FBResponseWithOK();
+}
+
+@end
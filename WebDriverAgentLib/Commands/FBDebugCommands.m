@@ -10,8 +10,11 @@
 #import "FBDebugCommands.h"
 
 #import "FBApplication.h"
+#import "FBElementCache.h"
 #import "FBRouteRequest.h"
 #import "FBSession.h"
+#import "FBSnapshotDescriber.h"
+#import "FBSourceRevisionStore.h"
 #import "XCUIApplication+FBHelpers.h"
 #import "XCUIElement+FBUtilities.h"
 #import "FBXPath.h"
@@ -37,6 +40,17 @@
 static NSString *const SOURCE_FORMAT_XML = @"xml";
 static NSString *const SOURCE_FORMAT_JSON = @"json";
 static NSString *const SOURCE_FORMAT_DESCRIPTION = @"description";
+static const NSUInteger FBSourceRevisionsCapacity = 4;
+
++ (FBSourceRevisionStore *)sourceRevisionStore
+{
+  static FBSourceRevisionStore *store;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    store = [[FBSourceRevisionStore alloc] initWithCapacity:FBSourceRevisionsCapacity];
+  });
+  return store;
+}
 
 + (id<FBResponsePayload>)handleGetSourceCommand:(FBRouteRequest *)request
 {
@@ -48,15 +62,36 @@ static NSString *const SOURCE_FORMAT_DESCRIPTION = @"description";
     result = [FBXPath xmlStringWithSnapshot:application.fb_lastSnapshot];
   } else if ([sourceType caseInsensitiveCompare:SOURCE_FORMAT_JSON] == NSOrderedSame) {
     result = application.fb_tree;
+    // Clients passing 'since' parameter (even an empty one) receive only the changes since the given revision
+    NSString *revision = request.parameters[@"since"];
+    if (nil != result && nil != revision) {
+      result = [self.sourceRevisionStore changesOfTree:result sinceRevision:0 == revision.length ? nil : revision];
+    }
   } else if ([sourceType caseInsensitiveCompare:SOURCE_FORMAT_DESCRIPTION] == NSOrderedSame) {
-    NSMutableArray<NSString *> *childrenDescriptions = [NSMutableArray array];
-    for (XCUIElement *child in [application childrenMatchingType:XCUIElementTypeAny].allElementsBoundByIndex) {
-      [childrenDescriptions addObject:child.debugDescription];
+    // The whole tree is described from a single snapshot, so that the cost is comparable to the XML source
+    NSUInteger maxDepth = NSUIntegerMax;
+    NSString *maxDepthValue = request.parameters[@"maxDepth"];
+    if (nil != maxDepthValue) {
+      NSScanner *scanner = [NSScanner scannerWithString:maxDepthValue];
+      NSInteger parsedDepth;
+      if (![scanner scanInteger:&parsedDepth] || !scanner.isAtEnd || parsedDepth < 0) {
+        return FBResponseWithStatus(FBCommandStatusInvalidArgument, [NSString stringWithFormat:@"'maxDepth' must be a non-negative integer, got '%@'", maxDepthValue]);
+      }
+      maxDepth = (NSUInteger)parsedDepth;
+    }
+    XCElementSnapshot *rootSnapshot;
+    NSString *elementUUID = request.parameters[@"element"];
+    if (nil != elementUUID) {
+      XCUIElement *element = [request.session.elementCache elementForUUID:elementUUID];
+      if (nil == element) {
+        return FBResponseWithStatus(FBCommandStatusNoSuchElement, [NSString stringWithFormat:@"Element '%@' is not cached in the current session", elementUUID]);
+      }
+      rootSnapshot = element.fb_lastSnapshot;
+    } else {
+      [application fb_waitUntilSnapshotIsStable];
+      rootSnapshot = application.fb_lastSnapshot;
     }
-    // debugDescription property of XCUIApplication instance shows descendants addresses in memory
-    // instead of the actual information about them, however the representation works properly
-    // for all descendant elements
-    result = (0 == childrenDescriptions.count) ? application.debugDescription : [childrenDescriptions componentsJoinedByString:@"\n\n"];
+    result = nil == rootSnapshot ? nil : [FBSnapshotDescriber descriptionOfSnapshot:rootSnapshot maxDepth:maxDepth];
   } else {
     return FBResponseWithStatus(
       FBCommandStatusUnsupported,
@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import "FBDiagnosticsCommands.h"
+
+#import "FBApplication.h"
+#import "FBLogger.h"
+#import "FBMainQueueWatchdog.h"
+#import "FBRouteMetrics.h"
+#import "FBRouteRequest.h"
+#import "FBTrace.h"
+
+static NSString *const FBPrometheusContentType = @"text/plain; version=0.0.4; charset=utf-8";
+
+@implementation FBDiagnosticsCommands
+
+#pragma mark - <FBCommandHandler>
+
++ (NSArray *)routes
+{
+  return
+  @[
+    [[FBRoute GET:@"/wda/metrics"].withoutSession.concurrent respondWithTarget:self action:@selector(handleGetMetrics:)],
+    [[FBRoute GET:@"/wda/trace"].withoutSession.concurrent respondWithTarget:self action:@selector(handleGetTrace:)],
+    [[FBRoute DELETE:@"/wda/trace"].withoutSession.concurrent respondWithTarget:self action:@selector(handleClearTrace:)],
+    [[FBRoute GET:@"/wda/logs"].withoutSession.concurrent respondWithTarget:self action:@selector(handleGetLogs:)],
+    [[FBRoute GET:@"/wda/mainQueue/stalls"].withoutSession.concurrent respondWithTarget:self action:@selector(handleGetMainQueueStalls:)],
+  ];
+}
+
+
+#pragma mark - Commands
+
++ (id<FBResponsePayload>)handleGetMetrics:(FBRouteRequest *)request
+{
+  NSMutableString *metricsText = [NSMutableString stringWithString:[FBRouteMetrics prometheusText]];
+  [metricsText appendString:[[FBMainQueueWatchdog sharedWatchdog] prometheusText]];
+  [metricsText appendFormat:@"# HELP wda_active_application_lookups_total Count of active application requests by tracking cache result\n# TYPE wda_active_application_lookups_total counter\nwda_active_application_lookups_total{result=\"hit\"} %lu\nwda_active_application_lookups_total{result=\"miss\"} %lu\n", (unsigned long)[FBApplication fb_activeApplicationCacheHits], (unsigned long)[FBApplication fb_activeApplicationCacheMisses]];
+  NSData *metricsData = [metricsText dataUsingEncoding:NSUTF8StringEncoding];
+  return FBResponseWithData(metricsData, FBPrometheusContentType);
+}
+
++ (id<FBResponsePayload>)handleGetTrace:(FBRouteRequest *)request
+{
+  // The trace is returned as is, so that it can be directly loaded into chrome://tracing
+  NSError *error;
+  NSData *traceData = [NSJSONSerialization dataWithJSONObject:[FBTrace chromeTraceEvents] options:0 error:&error];
+  if (nil == traceData) {
+    return FBResponseWithError(error);
+  }
+  return FBResponseWithData(traceData, @"application/json;charset=UTF-8");
+}
+
++ (id<FBResponsePayload>)handleClearTrace:(FBRouteRequest *)request
+{
+  [FBTrace clear];
+  return FBResponseWithOK();
+}
+
++ (id<FBResponsePayload>)handleGetLogs:(FBRouteRequest *)request
+{
+  NSMutableArray<NSDictionary *> *entries = [NSMutableArray array];
+  for (FBLogEntry *entry in [FBLogger recentEntries]) {
+    [entries addObject:entry.dictionaryRepresentation];
+  }
+  return FBResponseWithObject(entries);
+}
+
++ (id<FBResponsePayload>)handleGetMainQueueStalls:(FBRouteRequest *)request
+{
+  NSMutableArray<NSDictionary *> *stalls = [NSMutableArray array];
+  for (FBMainQueueStall *stall in [FBMainQueueWatchdog sharedWatchdog].recentStalls) {
+    [stalls addObject:stall.dictionaryRepresentation];
+  }
+  return FBResponseWithObject(stalls);
+}
+
+@end
@@ -16,6 +16,7 @@
 #import "FBRoute.h"
 #import "FBRouteRequest.h"
 #import "FBRunLoopSpinner.h"
+#import "FBScreenshotCommands.h"
 #import "FBElementCache.h"
 #import "FBErrorBuilder.h"
 #import "FBSession.h"
@@ -174,8 +175,10 @@
     return FBResponseWithOK();
   }
   NSUInteger frequency = (NSUInteger)[request.arguments[@"frequency"] longLongValue] ?: [FBConfiguration maxTypingFrequency];
+  // Replacing the current text sends removal and typing in a single event stream
+  BOOL shouldClear = [request.arguments[@"replace"] boolValue];
   NSError *error = nil;
-  if (![element fb_typeText:textToType frequency:frequency error:&error]) {
+  if (![element fb_typeText:textToType shouldClear:shouldClear frequency:frequency error:&error]) {
     return FBResponseWithError(error);
   }
   return FBResponseWithElementUUID(elementUUID);
@@ -292,14 +295,22 @@
   if (direction) {
     NSString *const distanceString = request.arguments[@"distance"] ?: @"1.0";
     CGFloat distance = (CGFloat)distanceString.doubleValue;
+    NSTimeInterval duration = [request.arguments[@"duration"] doubleValue];
+    CGVector vector;
     if ([direction isEqualToString:@"up"]) {
-      [element fb_scrollUpByNormalizedDistance:distance];
+      vector = CGVectorMake(0.0, distance);
     } else if ([direction isEqualToString:@"down"]) {
-      [element fb_scrollDownByNormalizedDistance:distance];
+      vector = CGVectorMake(0.0, -distance);
     } else if ([direction isEqualToString:@"left"]) {
-      [element fb_scrollLeftByNormalizedDistance:distance];
+      vector = CGVectorMake(distance, 0.0);
     } else if ([direction isEqualToString:@"right"]) {
-      [element fb_scrollRightByNormalizedDistance:distance];
+      vector = CGVectorMake(-distance, 0.0);
+    } else {
+      return FBResponseWithOK();
+    }
+    NSError *error;
+    if (![element fb_scrollByNormalizedVector:vector duration:duration error:&error]) {
+      return FBResponseWithError(error);
     }
     return FBResponseWithOK();
   }
@@ -422,12 +433,11 @@
   FBElementCache *elementCache = request.session.elementCache;
   XCUIElement *element = [elementCache elementForUUID:request.parameters[@"uuid"]];
   NSError *error;
-  NSData *screenshotData = [element fb_screenshotWithError:&error];
+  NSData *screenshotData = [element fb_rawScreenshotWithError:&error];
   if (nil == screenshotData) {
     return FBResponseWithError(error);
   }
-  NSString *screenshot = [screenshotData base64EncodedStringWithOptions:NSDataBase64Encoding64CharacterLineLength];
-  return FBResponseWithObject(screenshot);
+  return [FBScreenshotCommands responseWithScreenshotData:screenshotData request:request];
 }
 
 static const CGFloat DEFAULT_OFFSET = (CGFloat)0.2;
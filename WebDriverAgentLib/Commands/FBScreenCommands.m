@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import "FBScreenCommands.h"
+
+#import "FBRouteRequest.h"
+#import "FBScreenStabilityDetector.h"
+#import "FBScreenStream.h"
+#import "FBXCTestDaemonsProxy.h"
+
+static const NSUInteger FBDefaultStreamFramesPerSecond = 10;
+static const NSUInteger FBMaxStreamFramesPerSecond = 60;
+static const NSUInteger FBDefaultStreamQuality = 75;
+static const NSTimeInterval FBStreamFrameTimeout = 2.0;
+static const NSTimeInterval FBDefaultStabilityTimeout = 10.0;
+
+@implementation FBScreenCommands
+
+#pragma mark - <FBCommandHandler>
+
++ (NSArray *)routes
+{
+  return
+  @[
+    [[FBRoute GET:@"/wda/screen/stream"].withoutSession.concurrent respondWithTarget:self action:@selector(handleGetScreenStream:)],
+    [[FBRoute POST:@"/wda/screen/waitUntilStable"].withoutSession.concurrent respondWithTarget:self action:@selector(handleWaitUntilStable:)],
+  ];
+}
+
+
+#pragma mark - Commands
+
++ (id<FBResponsePayload>)handleGetScreenStream:(FBRouteRequest *)request
+{
+  NSUInteger framesPerSecond = FBDefaultStreamFramesPerSecond;
+  if (nil != request.parameters[@"fps"]) {
+    NSInteger requestedFramesPerSecond = [request.parameters[@"fps"] integerValue];
+    if (requestedFramesPerSecond < 1 || requestedFramesPerSecond > (NSInteger)FBMaxStreamFramesPerSecond) {
+      return FBResponseWithStatus(FBCommandStatusInvalidArgument, [NSString stringWithFormat:@"Stream frame rate must be in range [1, %lu]", (unsigned long)FBMaxStreamFramesPerSecond]);
+    }
+    framesPerSecond = (NSUInteger)requestedFramesPerSecond;
+  }
+  CGFloat scalingFactor = 1.0;
+  if (nil != request.parameters[@"scale"]) {
+    scalingFactor = (CGFloat)[request.parameters[@"scale"] doubleValue];
+    if (scalingFactor <= 0 || scalingFactor > 1) {
+      return FBResponseWithStatus(FBCommandStatusInvalidArgument, @"Stream scale must be in range (0, 1]");
+    }
+  }
+  NSInteger quality = FBDefaultStreamQuality;
+  if (nil != request.parameters[@"quality"]) {
+    quality = [request.parameters[@"quality"] integerValue];
+    if (quality < 1 || quality > 100) {
+      return FBResponseWithStatus(FBCommandStatusInvalidArgument, @"Stream quality must be in range [1, 100]");
+    }
+  }
+
+  FBScreenStreamFrameSource frameSource = ^NSData *{
+    return [FBXCTestDaemonsProxy screenshotWithTimeout:FBStreamFrameTimeout error:nil];
+  };
+  return [[FBScreenStream alloc] initWithFrameSource:frameSource
+                                     framesPerSecond:framesPerSecond
+                                       scalingFactor:scalingFactor
+                                  compressionQuality:(CGFloat)quality / 100];
+}
+
++ (id<FBResponsePayload>)handleWaitUntilStable:(FBRouteRequest *)request
+{
+  FBScreenStabilityDetector *detector = [[FBScreenStabilityDetector alloc] initWithFrameSource:^NSData *{
+    return [FBXCTestDaemonsProxy screenshotWithTimeout:FBStreamFrameTimeout error:nil];
+  }];
+  if (nil != request.arguments[@"frames"]) {
+    NSInteger framesCount = [request.arguments[@"frames"] integerValue];
+    if (framesCount < 2) {
+      return FBResponseWithStatus(FBCommandStatusInvalidArgument, @"At least 2 frames are required to detect stability");
+    }
+    detector.stableFramesCount = (NSUInteger)framesCount;
+  }
+  if (nil != request.arguments[@"interval"]) {
+    detector.samplingInterval = MAX(0, [request.arguments[@"interval"] doubleValue]);
+  }
+  if (nil != request.arguments[@"tolerance"]) {
+    detector.changedTilesTolerance = (NSUInteger)MAX(0, [request.arguments[@"tolerance"] integerValue]);
+  }
+  NSTimeInterval timeout = nil == request.arguments[@"timeout"] ? FBDefaultStabilityTimeout : [request.arguments[@"timeout"] doubleValue];
+
+  NSError *error;
+  if (![detector waitUntilStableWithTimeout:timeout error:&error]) {
+    return FBResponseWithStatus(FBCommandStatusTimeout, error.description);
+  }
+  return FBResponseWithObject(@{
+    @"sampledFrames": @(detector.sampledFramesCount),
+  });
+}
+
+@end
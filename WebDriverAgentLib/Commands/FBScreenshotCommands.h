@@ -13,8 +13,23 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+@class FBRouteRequest;
+
 @interface FBScreenshotCommands : NSObject <FBCommandHandler>
 
+/**
+ Formats the screenshot according to the options passed as request query parameters:
+ - format: 'png' (the default), 'jpeg' or 'native' to keep the format provided by XCTest
+ - quality: JPEG compression quality in range [1, 100]
+ - scale: image scaling factor in range (0, 1]
+ - binary: whether to send the image as is with its own content type instead of base64-encoded JSON value
+
+ @param screenshotData the screenshot data as provided by XCTest
+ @param request the screenshot request
+ @return the response payload
+ */
++ (id<FBResponsePayload>)responseWithScreenshotData:(NSData *)screenshotData request:(FBRouteRequest *)request;
+
 @end
 
 NS_ASSUME_NONNULL_END
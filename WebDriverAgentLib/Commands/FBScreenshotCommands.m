@@ -9,6 +9,10 @@
 
 #import "FBScreenshotCommands.h"
 
+#import "FBImageUtils.h"
+#import "FBRouteRequest.h"
+#import "FBScreenshotDiffer.h"
+#import "FBSession.h"
 #import "XCUIDevice+FBHelpers.h"
 
 @implementation FBScreenshotCommands
@@ -21,6 +25,7 @@
   @[
     [[FBRoute GET:@"/screenshot"].withoutSession respondWithTarget:self action:@selector(handleGetScreenshot:)],
     [[FBRoute GET:@"/screenshot"] respondWithTarget:self action:@selector(handleGetScreenshot:)],
+    [[FBRoute GET:@"/wda/screenshot/delta"] respondWithTarget:self action:@selector(handleGetScreenshotDelta:)],
   ];
 }
 
@@ -30,11 +35,107 @@
 + (id<FBResponsePayload>)handleGetScreenshot:(FBRouteRequest *)request
 {
   NSError *error;
-  NSData *screenshotData = [[XCUIDevice sharedDevice] fb_screenshotWithError:&error];
+  NSData *screenshotData = [[XCUIDevice sharedDevice] fb_rawScreenshotWithError:&error];
   if (nil == screenshotData) {
     return FBResponseWithError(error);
   }
-  NSString *screenshot = [screenshotData base64EncodedStringWithOptions:NSDataBase64Encoding64CharacterLineLength];
+  return [self responseWithScreenshotData:screenshotData request:request];
+}
+
++ (id<FBResponsePayload>)handleGetScreenshotDelta:(FBRouteRequest *)request
+{
+  NSString *format = [request.parameters[@"format"] lowercaseString] ?: @"png";
+  NSString *mimeType;
+  if ([format isEqualToString:@"png"]) {
+    mimeType = FBImageMimeTypePNG;
+  } else if ([format isEqualToString:@"jpeg"] || [format isEqualToString:@"jpg"]) {
+    mimeType = FBImageMimeTypeJPEG;
+  } else {
+    return FBResponseWithStatus(FBCommandStatusInvalidArgument, [NSString stringWithFormat:@"Screenshot format '%@' is not supported. Only png and jpeg formats are known", format]);
+  }
+  CGFloat compressionQuality = 1.0;
+  if (nil != request.parameters[@"quality"]) {
+    NSInteger quality = [request.parameters[@"quality"] integerValue];
+    if (quality < 1 || quality > 100) {
+      return FBResponseWithStatus(FBCommandStatusInvalidArgument, @"Screenshot quality must be in range [1, 100]");
+    }
+    compressionQuality = (CGFloat)quality / 100;
+  }
+  NSUInteger baseSequenceNumber = (NSUInteger)MAX(0, [request.parameters[@"since"] integerValue]);
+
+  NSError *error;
+  NSData *screenshotData = [[XCUIDevice sharedDevice] fb_rawScreenshotWithError:&error];
+  if (nil == screenshotData) {
+    return FBResponseWithError(error);
+  }
+  FBScreenshotDelta *delta = [request.session.screenshotDiffer deltaWithImageData:screenshotData
+                                                               baseSequenceNumber:baseSequenceNumber
+                                                                         mimeType:mimeType
+                                                               compressionQuality:compressionQuality
+                                                                            error:&error];
+  if (nil == delta) {
+    return FBResponseWithError(error);
+  }
+  NSMutableArray<NSDictionary *> *tiles = [NSMutableArray array];
+  for (FBScreenshotTile *tile in delta.tiles) {
+    [tiles addObject:@{
+      @"x": @(CGRectGetMinX(tile.rect)),
+      @"y": @(CGRectGetMinY(tile.rect)),
+      @"width": @(CGRectGetWidth(tile.rect)),
+      @"height": @(CGRectGetHeight(tile.rect)),
+      @"image": [tile.imageData base64EncodedStringWithOptions:0],
+    }];
+  }
+  return FBResponseWithObject(@{
+    @"sequence": @(delta.sequenceNumber),
+    @"base": delta.baseSequenceNumber > 0 ? @(delta.baseSequenceNumber) : [NSNull null],
+    @"width": @(delta.size.width),
+    @"height": @(delta.size.height),
+    @"format": mimeType,
+    @"tiles": tiles.copy,
+  });
+}
+
+
+#pragma mark - Helpers
+
++ (id<FBResponsePayload>)responseWithScreenshotData:(NSData *)screenshotData request:(FBRouteRequest *)request
+{
+  NSString *format = [request.parameters[@"format"] lowercaseString] ?: @"png";
+  NSString *mimeType;
+  if ([format isEqualToString:@"png"]) {
+    mimeType = FBImageMimeTypePNG;
+  } else if ([format isEqualToString:@"jpeg"] || [format isEqualToString:@"jpg"]) {
+    mimeType = FBImageMimeTypeJPEG;
+  } else if ([format isEqualToString:@"native"]) {
+    mimeType = FBImageMimeType(screenshotData) ?: FBImageMimeTypePNG;
+  } else {
+    return FBResponseWithStatus(FBCommandStatusInvalidArgument, [NSString stringWithFormat:@"Screenshot format '%@' is not supported. Only png, jpeg and native formats are known", format]);
+  }
+  CGFloat scalingFactor = 1.0;
+  if (nil != request.parameters[@"scale"]) {
+    scalingFactor = (CGFloat)[request.parameters[@"scale"] doubleValue];
+    if (scalingFactor <= 0 || scalingFactor > 1) {
+      return FBResponseWithStatus(FBCommandStatusInvalidArgument, @"Screenshot scale must be in range (0, 1]");
+    }
+  }
+  CGFloat compressionQuality = 1.0;
+  if (nil != request.parameters[@"quality"]) {
+    NSInteger quality = [request.parameters[@"quality"] integerValue];
+    if (quality < 1 || quality > 100) {
+      return FBResponseWithStatus(FBCommandStatusInvalidArgument, @"Screenshot quality must be in range [1, 100]");
+    }
+    compressionQuality = (CGFloat)quality / 100;
+  }
+
+  NSData *imageData = FBConvertedImageData(screenshotData, mimeType, scalingFactor, compressionQuality);
+  if (nil == imageData) {
+    return FBResponseWithErrorFormat(@"Cannot convert the screenshot to %@", mimeType);
+  }
+  if ([request.parameters[@"binary"] boolValue]) {
+    return FBResponseWithData(imageData, mimeType);
+  }
+  NSString *screenshot = [imageData base64EncodedStringWithOptions:NSDataBase64Encoding64CharacterLineLength];
   return FBResponseWithObject(screenshot);
 }
 
@@ -10,16 +10,30 @@
 #import "FBSessionCommands.h"
 
 #import "FBApplication.h"
+#import "FBApplicationPool.h"
 #import "FBConfiguration.h"
+#import "FBMainQueueProbe.h"
+#import "FBMainQueueWatchdog.h"
+#import "FBRouteMetrics.h"
 #import "FBRouteRequest.h"
 #import "FBSession.h"
 #import "FBApplication.h"
+#import "FBXCodeCompatibility.h"
 #import "XCUIDevice.h"
 #import "XCUIDevice+FBHealthCheck.h"
 #import "XCUIDevice+FBHelpers.h"
+#import "XCUIElement+FBUtilities.h"
+
+static const NSTimeInterval FBReadinessDefaultTimeout = 1.;
+static NSTimeInterval FBProcessStartUptime;
 
 @implementation FBSessionCommands
 
++ (void)load
+{
+  FBProcessStartUptime = [NSProcessInfo processInfo].systemUptime;
+}
+
 #pragma mark - <FBCommandHandler>
 
 + (NSArray *)routes
@@ -28,12 +42,17 @@
   @[
     [[FBRoute POST:@"/url"] respondWithTarget:self action:@selector(handleOpenURL:)],
     [[FBRoute POST:@"/session"].withoutSession respondWithTarget:self action:@selector(handleCreateSession:)],
+    [[FBRoute POST:@"/wda/apps/prewarm"].withoutSession respondWithTarget:self action:@selector(handlePrewarmApplication:)],
     [[FBRoute GET:@""] respondWithTarget:self action:@selector(handleGetActiveSession:)],
     [[FBRoute DELETE:@""] respondWithTarget:self action:@selector(handleDeleteSession:)],
-    [[FBRoute GET:@"/status"].withoutSession respondWithTarget:self action:@selector(handleGetStatus:)],
+    [[FBRoute GET:@"/sessions"].withoutSession respondWithTarget:self action:@selector(handleGetSessions:)],
+    [[FBRoute GET:@"/status"].withoutSession.concurrent respondWithTarget:self action:@selector(handleGetStatus:)],
 
     // Health check might modify simulator state so it should only be called in-between testing sessions
     [[FBRoute GET:@"/wda/healthcheck"].withoutSession respondWithTarget:self action:@selector(handleGetHealthCheck:)],
+    // Liveness and readiness checks do not touch the UI, so they can be polled at any time
+    [[FBRoute GET:@"/wda/healthcheck/liveness"].withoutSession.concurrent respondWithTarget:self action:@selector(handleGetLiveness:)],
+    [[FBRoute GET:@"/wda/healthcheck/readiness"].withoutSession.concurrent respondWithTarget:self action:@selector(handleGetReadiness:)],
   ];
 }
 
@@ -66,34 +85,73 @@
 {
   NSDictionary *requirements = request.arguments[@"desiredCapabilities"];
   NSString *bundleID = requirements[@"bundleId"];
-  NSString *appPath = requirements[@"app"];
   if (!bundleID) {
     return FBResponseWithErrorFormat(@"'bundleId' desired capability not provided");
   }
-  [FBConfiguration setShouldUseTestManagerForVisibilityDetection:[requirements[@"shouldUseTestManagerForVisibilityDetection"] boolValue]];
-  if (requirements[@"shouldUseCompactResponses"]) {
-    [FBConfiguration setShouldUseCompactResponses:[requirements[@"shouldUseCompactResponses"] boolValue]];
+  NSString *poolKey = [requirements[@"shouldReuseApplication"] boolValue] ? [FBApplicationPool keyWithCapabilities:requirements] : nil;
+  FBApplication *app = poolKey ? [self reusedApplicationWithKey:poolKey] : nil;
+  if (app) {
+    NSString *softResetURLString = requirements[@"softResetURL"];
+    NSURL *softResetURL = softResetURLString ? [NSURL URLWithString:softResetURLString] : nil;
+    #pragma clang diagnostic push
+    #pragma clang diagnostic ignored "-Wdeprecated-declarations"
+    if (softResetURL && ![[UIApplication sharedApplication] openURL:softResetURL]) {
+      [app terminate];
+      app = nil;
+    }
+    #pragma clang diagnostic pop
+    // openURL: only tells that the scheme is handled, so the session is not returned
+    // until the application has finished the UI updates triggered by the reset
+    if (app && softResetURL) {
+      [app fb_waitUntilSnapshotIsStable];
+    }
   }
-  if (requirements[@"maxTypingFrequency"]) {
-    [FBConfiguration setMaxTypingFrequency:[requirements[@"maxTypingFrequency"] integerValue]];
+  if (!app) {
+    app = [self launchedApplicationWithCapabilities:requirements];
   }
+  if (app.processID == 0) {
+    return FBResponseWithErrorFormat(@"Failed to launch %@ application", bundleID);
+  }
+  FBSession *session = [FBSession sessionWithApplication:app settings:[FBConfiguration settingsWithCapabilities:requirements]];
+  session.applicationPoolKey = poolKey;
+  __block id<FBResponsePayload> payload;
+  [session performAsCurrentSession:^{
+    payload = FBResponseWithObject([FBSessionCommands sessionInformationOfSession:session]);
+  }];
+  return payload;
+}
 
-  FBApplication *app = [[FBApplication alloc] initPrivateWithPath:appPath bundleID:bundleID];
-  app.fb_shouldWaitForQuiescence = [requirements[@"shouldWaitForQuiescence"] boolValue];
-  app.launchArguments = (NSArray<NSString *> *)requirements[@"arguments"] ?: @[];
-  app.launchEnvironment = (NSDictionary <NSString *, NSString *> *)requirements[@"environment"] ?: @{};
-  [app launch];
-
++ (id<FBResponsePayload>)handlePrewarmApplication:(FBRouteRequest *)request
+{
+  NSDictionary *requirements = request.arguments[@"desiredCapabilities"];
+  NSString *bundleID = requirements[@"bundleId"];
+  if (!bundleID) {
+    return FBResponseWithErrorFormat(@"'bundleId' desired capability not provided");
+  }
+  NSString *poolKey = [FBApplicationPool keyWithCapabilities:requirements];
+  FBApplication *app = [[FBApplicationPool sharedPool] checkoutApplicationWithKey:poolKey] ?: [self launchedApplicationWithCapabilities:requirements];
   if (app.processID == 0) {
     return FBResponseWithErrorFormat(@"Failed to launch %@ application", bundleID);
   }
-  [FBSession sessionWithApplication:app];
-  return FBResponseWithObject(FBSessionCommands.sessionInformation);
+  [[FBApplicationPool sharedPool] checkinApplication:app withKey:poolKey];
+  return FBResponseWithOK();
 }
 
 + (id<FBResponsePayload>)handleGetActiveSession:(FBRouteRequest *)request
 {
-  return FBResponseWithObject(FBSessionCommands.sessionInformation);
+  return FBResponseWithObject([FBSessionCommands sessionInformationOfSession:request.session]);
+}
+
++ (id<FBResponsePayload>)handleGetSessions:(FBRouteRequest *)request
+{
+  NSMutableArray<NSDictionary *> *sessions = [NSMutableArray array];
+  for (FBSession *session in [FBSession allSessions]) {
+    [sessions addObject:@{
+      @"id" : session.identifier,
+      @"capabilities" : [FBSessionCommands capabilitiesOfSession:session],
+    }];
+  }
+  return FBResponseWithObject(sessions);
 }
 
 + (id<FBResponsePayload>)handleDeleteSession:(FBRouteRequest *)request
@@ -123,21 +181,81 @@
         @{
           @"time" : [self.class buildTimestamp],
         },
+      @"mainQueue" :
+        @{
+          @"lag" : @([FBMainQueueWatchdog sharedWatchdog].currentLag),
+          @"stalls" : @([FBMainQueueWatchdog sharedWatchdog].stallsCount),
+        },
+      @"requests" :
+        @{
+          @"queued" : @(FBRouteMetricsQueuedRequestsCount()),
+          @"inFlight" : @(FBRouteMetricsInFlightRequestsCount()),
+        },
     }
   );
 }
 
 + (id<FBResponsePayload>)handleGetHealthCheck:(FBRouteRequest *)request
 {
-  if (![[XCUIDevice sharedDevice] fb_healthCheckWithApplication:[FBApplication fb_activeApplication]]) {
+  if (![[XCUIDevice sharedDevice] fb_healthCheckWithApplication:[FBApplication fb_refreshActiveApplication]]) {
     return FBResponseWithErrorFormat(@"Health check failed");
   }
   return FBResponseWithOK();
 }
 
++ (id<FBResponsePayload>)handleGetLiveness:(FBRouteRequest *)request
+{
+  return FBResponseWithObject(@{
+    @"state" : @"alive",
+    @"uptime" : @([NSProcessInfo processInfo].systemUptime - FBProcessStartUptime),
+  });
+}
+
++ (id<FBResponsePayload>)handleGetReadiness:(FBRouteRequest *)request
+{
+  NSTimeInterval timeout = request.parameters[@"timeout"] ? [request.parameters[@"timeout"] doubleValue] : FBReadinessDefaultTimeout;
+  if (timeout <= 0) {
+    return FBResponseWithStatus(FBCommandStatusInvalidArgument, @"'timeout' must be a positive number of seconds");
+  }
+  NSTimeInterval latency = [FBMainQueueProbe latencyWithTimeout:timeout];
+  BOOL isReady = latency >= 0;
+  return FBResponseWithObject(@{
+    @"ready" : @(isReady),
+    @"mainQueueLatency" : isReady ? @(latency) : NSNull.null,
+    // The readiness request itself is pending as well
+    @"pendingRequests" : @(FBRouteMetricsPendingRequestsCount() - 1),
+  });
+}
+
 
 #pragma mark - Helpers
 
++ (FBApplication *)launchedApplicationWithCapabilities:(NSDictionary *)requirements
+{
+  FBApplication *app = [[FBApplication alloc] initPrivateWithPath:requirements[@"app"] bundleID:requirements[@"bundleId"]];
+  app.fb_shouldWaitForQuiescence = [requirements[@"shouldWaitForQuiescence"] boolValue];
+  app.launchArguments = (NSArray<NSString *> *)requirements[@"arguments"] ?: @[];
+  app.launchEnvironment = (NSDictionary <NSString *, NSString *> *)requirements[@"environment"] ?: @{};
+  [app launch];
+  return app;
+}
+
++ (FBApplication *)reusedApplicationWithKey:(NSString *)poolKey
+{
+  FBApplication *app = [[FBApplicationPool sharedPool] checkoutApplicationWithKey:poolKey];
+  if (!app) {
+    return nil;
+  }
+  // Applications kept in the pool might be in background and can only be brought back on Xcode 9+
+  if (!app.fb_isActivateSupported) {
+    [app terminate];
+    return nil;
+  }
+  [app fb_activate];
+  [FBApplication fb_invalidateActiveApplication];
+  return app;
+}
+
 + (NSString *)buildTimestamp
 {
   return [NSString stringWithFormat:@"%@ %@",
@@ -146,18 +264,18 @@
   ];
 }
 
-+ (NSDictionary *)sessionInformation
++ (NSDictionary *)sessionInformationOfSession:(FBSession *)session
 {
   return
   @{
-    @"sessionId" : [FBSession activeSession].identifier ?: NSNull.null,
-    @"capabilities" : FBSessionCommands.currentCapabilities
+    @"sessionId" : session.identifier ?: NSNull.null,
+    @"capabilities" : [FBSessionCommands capabilitiesOfSession:session]
   };
 }
 
-+ (NSDictionary *)currentCapabilities
++ (NSDictionary *)capabilitiesOfSession:(FBSession *)session
 {
-  FBApplication *application = [FBSession activeSession].application;
+  FBApplication *application = session.application;
   return
   @{
     @"device": ([UIDevice currentDevice].userInterfaceIdiom == UIUserInterfaceIdiomPad) ? @"ipad" : @"iphone",
@@ -11,18 +11,22 @@
 
 #import <XCTest/XCUICoordinate.h>
 
+#import "FBAlertsMonitor.h"
 #import "FBApplication.h"
 #import "FBErrorBuilder.h"
 #import "FBFindElementCommands.h"
 #import "FBSpringboardApplication.h"
 #import "FBLogger.h"
 #import "FBXCodeCompatibility.h"
+#import "XCAccessibilityElement.h"
 #import "XCAXClient_iOS.h"
 #import "XCElementSnapshot+FBHelpers.h"
 #import "XCElementSnapshot.h"
 #import "XCTestManager_ManagerInterface-Protocol.h"
+#import "XCUIApplication.h"
 #import "XCUICoordinate.h"
 #import "XCUIElement+FBTap.h"
+#import "XCUIElement+FBUID.h"
 #import "XCUIElement+FBUtilities.h"
 #import "XCUIElement+FBWebDriverAttributes.h"
 #import "XCUIElement.h"
@@ -83,7 +87,7 @@ NSString *const FBAlertObstructingElementException = @"FBAlertObstructingElement
 
 - (BOOL)isPresent
 {
-  return self.alertElement.exists;
+  return nil != self.alertElement;
 }
 
 - (NSString *)text
@@ -137,6 +141,7 @@ NSString *const FBAlertObstructingElementException = @"FBAlertObstructingElement
       withDescriptionFormat:@"Failed to find accept button for alert: %@", alertElement]
      buildError:error];
   }
+  [[FBAlertsMonitor sharedMonitor] invalidate];
   return [defaultButton fb_tapWithError:error];
 }
 
@@ -158,6 +163,7 @@ NSString *const FBAlertObstructingElementException = @"FBAlertObstructingElement
      buildError:error];
     return NO;
   }
+  [[FBAlertsMonitor sharedMonitor] invalidate];
   return [cancelButton fb_tapWithError:error];
 }
 
@@ -181,53 +187,75 @@ NSString *const FBAlertObstructingElementException = @"FBAlertObstructingElement
      buildError:error];
   }
   
+  [[FBAlertsMonitor sharedMonitor] invalidate];
   return [requestedButton fb_tapWithError:error];
 }
 
-+ (BOOL)isElementObstructedByAlertView:(XCUIElement *)element alert:(XCUIElement *)alert
-{
-  if (!alert.exists) {
-    return NO;
-  }
-  XCElementSnapshot *alertSnapshot = alert.fb_lastSnapshot;
-  XCElementSnapshot *elementSnapshot = element.fb_lastSnapshot;
-  if ([alertSnapshot _isAncestorOfElement:elementSnapshot]) {
-    return NO;
-  }
-  if ([alertSnapshot _matchesElement:elementSnapshot]) {
-    return NO;
-  }
-  return YES;
-}
-
 - (NSArray<XCUIElement *> *)filterObstructedElements:(NSArray<XCUIElement *> *)elements
 {
-  XCUIElement *alertElement = self.alertElement;
-  XCUIElement *element = elements.lastObject;
-  if (!element) {
+  if (0 == elements.count) {
+    return elements;
+  }
+  XCElementSnapshot *alertSnapshot = self.alertElement.fb_lastSnapshot;
+  if (!alertSnapshot) {
     return elements;
   }
+  // Cached element snapshots are only trusted if they have been taken after the alert has appeared
+  NSNumber *alertLookupTimestamp = [[FBAlertsMonitor sharedMonitor] lookupTimestampOfApplicationWithBundleID:self.alertsMonitorKey];
+  NSTimeInterval minimumSnapshotTimestamp = alertLookupTimestamp ? alertLookupTimestamp.doubleValue : [NSProcessInfo processInfo].systemUptime;
+  // Elements, which are neither the alert itself nor its descendants, are obstructed.
+  // The alert is snapshotted only once and each element is checked against the set of its identities
+  NSSet<NSString *> *alertIdentities = [FBAlert identitiesOfSnapshotTree:alertSnapshot];
   NSMutableArray *elementBox = [NSMutableArray array];
   for (XCUIElement *iElement in elements) {
-    if ([FBAlert isElementObstructedByAlertView:iElement alert:alertElement]) {
-      continue;
+    XCElementSnapshot *elementSnapshot = iElement.lastSnapshot;
+    if (nil == elementSnapshot || iElement.fb_lastResolveTimestamp < minimumSnapshotTimestamp) {
+      elementSnapshot = iElement.fb_lastSnapshot;
+    }
+    if ([alertIdentities containsObject:[FBAlert identityOfSnapshot:elementSnapshot]]) {
+      [elementBox addObject:iElement];
     }
-    [elementBox addObject:iElement];
   }
-  if (elementBox.count == 0 && elements.count != 0) {
+  if (elementBox.count == 0) {
     [FBAlert throwRequestedItemObstructedByAlertException];
   }
   return elementBox.copy;
 }
 
+/**
+ Element IDs are only unique inside of their process, while Springboard alerts and application elements
+ belong to different processes
+ */
++ (NSString *)identityOfSnapshot:(XCElementSnapshot *)snapshot
+{
+  return [NSString stringWithFormat:@"%d:%lu", snapshot.accessibilityElement.processIdentifier, (unsigned long)snapshot.fb_uid];
+}
+
++ (NSSet<NSString *> *)identitiesOfSnapshotTree:(XCElementSnapshot *)rootSnapshot
+{
+  NSMutableSet<NSString *> *identities = [NSMutableSet setWithObject:[self identityOfSnapshot:rootSnapshot]];
+  [rootSnapshot enumerateDescendantsUsingBlock:^(XCElementSnapshot *snapshot) {
+    [identities addObject:[self identityOfSnapshot:snapshot]];
+  }];
+  return identities.copy;
+}
+
+- (NSString *)alertsMonitorKey
+{
+  return self.application.bundleID ?: @"";
+}
+
 - (XCUIElement *)alertElement
 {
-  XCUIElement *alert = self.application.fb_alertElement ?: [FBSpringboardApplication fb_springboard].fb_alertElement;
-  if (!alert.exists) {
-    return nil;
-  }
-  [alert resolve];
-  return alert;
+  XCUIApplication *application = self.application;
+  return [[FBAlertsMonitor sharedMonitor] alertElementForApplicationWithBundleID:self.alertsMonitorKey lookup:^XCUIElement *{
+    XCUIElement *alert = application.fb_alertElement ?: [FBSpringboardApplication fb_springboard].fb_alertElement;
+    if (!alert.exists) {
+      return nil;
+    }
+    [alert resolve];
+    return alert;
+  }];
 }
 
 @end
@@ -14,10 +14,34 @@ NS_ASSUME_NONNULL_BEGIN
 @interface FBApplication : XCUIApplication
 
 /**
- Constructor used to get current active application
+ Constructor used to get current active application.
+ The application is tracked between calls and is looked up again after accessibility
+ notifications report a screen change (layout changes are ignored), an application gets
+ launched, terminated or activated, or the tracked application is older than 5 seconds.
  */
 + (nullable instancetype)fb_activeApplication;
 
+/**
+ Looks up current active application regardless of the tracked one and starts tracking the result.
+ Should be used if the screen might have changed without posting accessibility notifications.
+ */
++ (nullable instancetype)fb_refreshActiveApplication;
+
+/**
+ Drops the tracked active application, so the next fb_activeApplication call looks it up again
+ */
++ (void)fb_invalidateActiveApplication;
+
+/**
+ The count of fb_activeApplication calls, which returned the tracked application
+ */
++ (NSUInteger)fb_activeApplicationCacheHits;
+
+/**
+ The count of fb_activeApplication calls, which had to look the active application up
+ */
++ (NSUInteger)fb_activeApplicationCacheMisses;
+
 /**
  It allows to turn on/off waiting for application quiescence, while performing queries. Defaults to NO.
  */
@@ -9,9 +9,11 @@
 
 #import "FBApplication.h"
 
+#import "FBAccessibilityNotificationsObserver.h"
 #import "FBApplicationProcessProxy.h"
 #import "FBRunLoopSpinner.h"
 #import "FBMacros.h"
+#import "FBTrace.h"
 #import "FBXCodeCompatibility.h"
 #import "XCAccessibilityElement.h"
 #import "XCAXClient_iOS.h"
@@ -27,8 +29,95 @@
 
 @implementation FBApplication
 
+#pragma mark - Active application tracking
+
+/*! Maximum age of the tracked application. Protects from screen changes, which post no notifications (e.g. crashes) */
+static const NSTimeInterval FBTrackedActiveApplicationMaxAge = 5.;
+
+static FBApplication *FBTrackedActiveApplication;
+static BOOL FBIsTrackedActiveApplicationValid = NO;
+static NSTimeInterval FBTrackedActiveApplicationTimestamp = 0;
+static NSUInteger FBActiveApplicationGeneration = 0;
+static NSUInteger FBActiveApplicationCacheHits = 0;
+static NSUInteger FBActiveApplicationCacheMisses = 0;
+
++ (void)initialize
+{
+  if (self != FBApplication.class) {
+    return;
+  }
+  if (![FBAccessibilityNotificationsObserver startObserving]) {
+    return;
+  }
+  [[NSNotificationCenter defaultCenter] addObserverForName:FBAccessibilityNotificationReceivedNotification
+                                                    object:nil
+                                                     queue:nil
+                                                usingBlock:^(NSNotification *notification) {
+    // Layout changes are posted on nearly every UI update, but they never switch the active application
+    if (FBAccessibilityNotificationTypeScreenChanged == [notification.userInfo[FBAccessibilityNotificationTypeKey] intValue]) {
+      [FBApplication fb_invalidateActiveApplication];
+    }
+  }];
+}
+
 + (instancetype)fb_activeApplication
 {
+  @synchronized (FBApplication.class) {
+    NSTimeInterval age = [NSProcessInfo processInfo].systemUptime - FBTrackedActiveApplicationTimestamp;
+    if (FBIsTrackedActiveApplicationValid && age < FBTrackedActiveApplicationMaxAge) {
+      FBActiveApplicationCacheHits++;
+      return FBTrackedActiveApplication;
+    }
+    FBActiveApplicationCacheMisses++;
+  }
+  return [self fb_refreshActiveApplication];
+}
+
++ (instancetype)fb_refreshActiveApplication
+{
+  NSUInteger generation;
+  NSTimeInterval lookupStartTimestamp = [NSProcessInfo processInfo].systemUptime;
+  @synchronized (FBApplication.class) {
+    generation = FBActiveApplicationGeneration;
+  }
+  FBApplication *application = [self fb_lookupActiveApplication];
+  @synchronized (FBApplication.class) {
+    // Only keep the application if no screen change happened during the lookup
+    if (generation == FBActiveApplicationGeneration && [FBAccessibilityNotificationsObserver startObserving]) {
+      FBTrackedActiveApplication = application;
+      FBIsTrackedActiveApplicationValid = nil != application;
+      FBTrackedActiveApplicationTimestamp = lookupStartTimestamp;
+    }
+  }
+  return application;
+}
+
++ (void)fb_invalidateActiveApplication
+{
+  @synchronized (FBApplication.class) {
+    FBActiveApplicationGeneration++;
+    FBIsTrackedActiveApplicationValid = NO;
+    FBTrackedActiveApplication = nil;
+  }
+}
+
++ (NSUInteger)fb_activeApplicationCacheHits
+{
+  @synchronized (FBApplication.class) {
+    return FBActiveApplicationCacheHits;
+  }
+}
+
++ (NSUInteger)fb_activeApplicationCacheMisses
+{
+  @synchronized (FBApplication.class) {
+    return FBActiveApplicationCacheMisses;
+  }
+}
+
++ (instancetype)fb_lookupActiveApplication
+{
+  FBTraceBegin("XCAXClient_iOS activeApplications");
   [[[FBRunLoopSpinner new]
     timeout:5]
    spinUntilTrue:^BOOL{
@@ -36,6 +125,7 @@
    }];
 
   XCAccessibilityElement *activeApplicationElement = [[[XCAXClient_iOS sharedClient] activeApplications] firstObject];
+  FBTraceEnd("XCAXClient_iOS activeApplications");
   if (!activeApplicationElement) {
     return nil;
   }
@@ -44,6 +134,8 @@
   return application;
 }
 
+#pragma mark - Application lifecycle
+
 + (instancetype)appWithPID:(pid_t)processID
 {
   if ([NSProcessInfo processInfo].processIdentifier == processID) {
@@ -78,6 +170,7 @@
     [self.fb_appImpl addObserver:self forKeyPath:FBStringify(XCUIApplicationImpl, currentProcess) options:(NSKeyValueObservingOptions)(NSKeyValueObservingOptionInitial | NSKeyValueObservingOptionNew) context:nil];
     self.fb_isObservingAppImplCurrentProcess = YES;
   }
+  [FBApplication fb_invalidateActiveApplication];
   [super launch];
   [FBApplication fb_registerApplication:self withProcessID:self.processID];
 }
@@ -87,6 +180,7 @@
   if (self.fb_isObservingAppImplCurrentProcess) {
     [self.fb_appImpl removeObserver:self forKeyPath:FBStringify(XCUIApplicationImpl, currentProcess)];
   }
+  [FBApplication fb_invalidateActiveApplication];
   [super terminate];
 }
 
@@ -9,9 +9,10 @@
 
 #import "FBSpringboardApplication.h"
 
+#import "FBAccessibilityNotificationsObserver.h"
 #import "FBErrorBuilder.h"
-#import "FBMathUtils.h"
 #import "FBRunLoopSpinner.h"
+#import "FBSpringboardIconIndex.h"
 #import "XCElementSnapshot+FBHelpers.h"
 #import "XCElementSnapshot.h"
 #import "XCUIApplication+FBHelpers.h"
@@ -24,6 +25,10 @@
 
 NSString *const SPRINGBOARD_BUNDLE_ID = @"com.apple.springboard";
 
+static const NSUInteger FBSpringboardMaxPageSwitchAttempts = 3;
+static const NSTimeInterval FBSpringboardPageSwitchCoolOffTime = 0.5;
+static const NSTimeInterval FBSpringboardActivationFallbackInterval = 1.;
+
 @implementation FBSpringboardApplication
 
 + (instancetype)fb_springboard
@@ -40,51 +45,74 @@ NSString *const SPRINGBOARD_BUNDLE_ID = @"com.apple.springboard";
 
 - (BOOL)fb_tapApplicationWithIdentifier:(NSString *)identifier error:(NSError **)error
 {
-  XCUIElementQuery *appElementsQuery = [[self descendantsMatchingType:XCUIElementTypeIcon] matchingIdentifier:identifier];
-  NSArray<XCUIElement *> *matchedAppElements = [appElementsQuery allElementsBoundByIndex];
-  if (0 == matchedAppElements.count) {
+  FBSpringboardIcon *icon = [self fb_iconForApplicationWithIdentifier:identifier];
+  if (!icon) {
     return [[[FBErrorBuilder builder]
       withDescriptionFormat:@"Cannot locate Springboard icon for '%@' application", identifier]
      buildError:error];
   }
-  // Select the most recent installed application if there are multiple matches
-  XCUIElement *appElement = [matchedAppElements lastObject];
-  if (!appElement.fb_isVisible) {
-    CGRect startFrame = appElement.frame;
-    BOOL shouldSwipeToTheRight = startFrame.origin.x < 0;
-    NSString *errorDescription = [NSString stringWithFormat:@"Cannot scroll to Springboard icon for '%@' application", identifier];
-    do {
-      if (shouldSwipeToTheRight) {
+  for (NSUInteger attempt = 0; icon.page != 0; attempt++) {
+    if (attempt >= FBSpringboardMaxPageSwitchAttempts) {
+      return [[[FBErrorBuilder builder]
+        withDescriptionFormat:@"Cannot scroll to Springboard icon for '%@' application", identifier]
+       buildError:error];
+    }
+    // Jump over all pages at once and only look at the icons again after the last swipe
+    for (NSInteger page = 0; page < ABS(icon.page); page++) {
+      if (icon.page < 0) {
         [self swipeRight];
       } else {
         [self swipeLeft];
       }
-      BOOL isSwipeSuccessful = [appElement fb_waitUntilFrameIsStable] &&
-        [[[[FBRunLoopSpinner new]
-           timeout:1]
-          timeoutErrorMessage:errorDescription]
-         spinUntilTrue:^BOOL{
-           return !FBRectFuzzyEqualToRect(startFrame, appElement.frame, FBDefaultFrameFuzzyThreshold);
-         }
-         error:error];
-      if (!isSwipeSuccessful) {
-        return NO;
-      }
-    } while (!appElement.fb_isVisible);
+    }
+    [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:FBSpringboardPageSwitchCoolOffTime]];
+    icon = [self fb_iconForApplicationWithIdentifier:identifier];
   }
-  if (![appElement fb_tapWithError:error]) {
+  // Springboard covers the whole screen, so the icon frame can be used as relative coordinate
+  CGPoint iconCenter = CGPointMake(CGRectGetMidX(icon.frame), CGRectGetMidY(icon.frame));
+  if (![self fb_tapCoordinate:iconCenter error:error]) {
     return NO;
   }
-  return
+  return [self fb_waitUntilApplicationIsActivatedWithError:error];
+}
+
+- (FBSpringboardIcon *)fb_iconForApplicationWithIdentifier:(NSString *)identifier
+{
+  return [[FBSpringboardIconIndex indexWithSnapshot:self.fb_lastSnapshot] iconForApplicationWithIdentifier:identifier];
+}
+
+- (BOOL)fb_waitUntilApplicationIsActivatedWithError:(NSError **)error
+{
+  // The active application is only looked up again after the screen has changed,
+  // or once in a while if accessibility notifications are not delivered
+  __block volatile BOOL didScreenChange = YES;
+  __block NSTimeInterval lastCheckTime = 0;
+  BOOL isObservingNotifications = [FBAccessibilityNotificationsObserver startObserving];
+  id observer = [[NSNotificationCenter defaultCenter] addObserverForName:FBAccessibilityNotificationReceivedNotification
+                                                                  object:nil
+                                                                   queue:nil
+                                                              usingBlock:^(NSNotification *notification) {
+    didScreenChange = YES;
+  }];
+  BOOL result =
   [[[[FBRunLoopSpinner new]
-     interval:0.3]
+     interval:0.05]
     timeoutErrorMessage:@"Timeout waiting for application to activate"]
    spinUntilTrue:^BOOL{
-     FBApplication *activeApp = [FBApplication fb_activeApplication];
+     NSTimeInterval now = [NSProcessInfo processInfo].systemUptime;
+     NSTimeInterval checkInterval = isObservingNotifications ? FBSpringboardActivationFallbackInterval : 0.3;
+     if (!didScreenChange && now - lastCheckTime < checkInterval) {
+       return NO;
+     }
+     didScreenChange = NO;
+     lastCheckTime = now;
+     FBApplication *activeApp = [FBApplication fb_refreshActiveApplication];
      return activeApp &&
-        activeApp.processID != self.processID &&
-     activeApp.fb_isVisible;
+       activeApp.processID != self.processID &&
+       activeApp.fb_isVisible;
    } error:error];
+  [[NSNotificationCenter defaultCenter] removeObserver:observer];
+  return result;
 }
 
 - (BOOL)fb_waitUntilApplicationBoardIsVisible:(NSError **)error
@@ -33,7 +33,9 @@
 - (NSString *)storeElement:(XCUIElement *)element
 {
   NSString *uuid = [[NSUUID UUID] UUIDString];
-  self.elementCache[uuid] = element;
+  @synchronized (self) {
+    self.elementCache[uuid] = element;
+  }
   return uuid;
 }
 
@@ -42,18 +44,25 @@
   if (!uuid) {
     return nil;
   }
-  XCUIElement *element = self.elementCache[uuid];
-  [element resolve];
+  XCUIElement *element;
+  @synchronized (self) {
+    element = self.elementCache[uuid];
+  }
+  [element fb_resolve];
   return element;
 }
 
 - (void)clear
 {
-  [self.elementCache removeAllObjects];
+  @synchronized (self) {
+    [self.elementCache removeAllObjects];
+  }
 }
 
 - (NSUInteger)count
 {
-  return [self.elementCache count];
+  @synchronized (self) {
+    return [self.elementCache count];
+  }
 }
 @end
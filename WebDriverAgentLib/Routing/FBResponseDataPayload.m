@@ -0,0 +1,45 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import "FBResponseDataPayload.h"
+
+#import <RoutingHTTPServer/RouteResponse.h>
+
+@interface FBResponseDataPayload ()
+
+@property (nonatomic, copy, readonly) NSData *data;
+@property (nonatomic, copy, readonly) NSString *contentType;
+
+@end
+
+@implementation FBResponseDataPayload
+
+- (instancetype)initWithData:(NSData *)data contentType:(NSString *)contentType
+{
+  NSParameterAssert(data);
+  NSParameterAssert(contentType);
+  if (!data || !contentType) {
+    return nil;
+  }
+
+  self = [super init];
+  if (self) {
+    _data = data;
+    _contentType = contentType;
+  }
+  return self;
+}
+
+- (void)dispatchWithResponse:(RouteResponse *)response
+{
+  [response setHeader:@"Content-Type" value:self.contentType];
+  [response respondWithData:self.data];
+}
+
+@end
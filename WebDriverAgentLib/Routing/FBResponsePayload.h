@@ -63,6 +63,11 @@ id<FBResponsePayload> FBResponseWithStatus(FBCommandStatus status, __nullable id
  */
 id<FBResponsePayload> FBResponseFileWithPath(NSString *path);
 
+/**
+ Returns response payload with given raw 'data' and 'contentType' header
+ */
+id<FBResponsePayload> FBResponseWithData(NSData *data, NSString *contentType);
+
 
 /**
  Protocol for objects that can dispatch some kind of a payload for given 'response'
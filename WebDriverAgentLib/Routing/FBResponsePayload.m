@@ -10,6 +10,7 @@
 #import "FBResponsePayload.h"
 
 #import "FBElementCache.h"
+#import "FBResponseDataPayload.h"
 #import "FBResponseFilePayload.h"
 #import "FBResponseJSONPayload.h"
 #import "FBSession.h"
@@ -18,6 +19,7 @@
 #import "XCUIElement+FBWebDriverAttributes.h"
 
 inline static NSDictionary *FBDictionaryResponseWithElement(XCUIElement *element, NSString *elementUUID, BOOL compact);
+inline static NSString *FBResponseSessionIdentifier(void);
 
 id<FBResponsePayload> FBResponseWithOK()
 {
@@ -49,7 +51,7 @@ id<FBResponsePayload> FBResponseWithElementUUID(NSString *elementUUID)
 {
   return [[FBResponseJSONPayload alloc] initWithDictionary:@{
     @"id" : elementUUID,
-    @"sessionId" : [FBSession activeSession].identifier ?: NSNull.null,
+    @"sessionId" : FBResponseSessionIdentifier() ?: NSNull.null,
     @"value" : @"",
     @"status" : @0,
   }];
@@ -74,7 +76,7 @@ id<FBResponsePayload> FBResponseWithStatus(FBCommandStatus status, id object)
 {
   return [[FBResponseJSONPayload alloc] initWithDictionary:@{
     @"value" : object ?: @{},
-    @"sessionId" : [FBSession activeSession].identifier ?: NSNull.null,
+    @"sessionId" : FBResponseSessionIdentifier() ?: NSNull.null,
     @"status" : @(status),
   }];
 }
@@ -84,6 +86,11 @@ id<FBResponsePayload> FBResponseFileWithPath(NSString *path)
   return [[FBResponseFilePayload alloc] initWithFilePath:path];
 }
 
+id<FBResponsePayload> FBResponseWithData(NSData *data, NSString *contentType)
+{
+  return [[FBResponseDataPayload alloc] initWithData:data contentType:contentType];
+}
+
 inline static NSDictionary *FBDictionaryResponseWithElement(XCUIElement *element, NSString *elementUUID, BOOL compact)
 {
   NSMutableDictionary *dictionary = [NSMutableDictionary new];
@@ -95,3 +102,9 @@ inline static NSDictionary *FBDictionaryResponseWithElement(XCUIElement *element
   }
   return dictionary.copy;
 }
+
+inline static NSString *FBResponseSessionIdentifier(void)
+{
+  // Responses belong to the session of the handled request, if there is one
+  return (FBSession.currentSession ?: FBSession.activeSession).identifier;
+}
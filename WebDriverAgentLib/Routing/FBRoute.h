@@ -11,6 +11,7 @@
 
 @protocol FBResponsePayload;
 @class FBRouteRequest;
+@class FBRouteMetrics;
 @class RouteResponse;
 
 NS_ASSUME_NONNULL_BEGIN
@@ -28,6 +29,12 @@ typedef __nonnull id<FBResponsePayload> (^FBRouteSyncHandler)(FBRouteRequest *re
 /*! Route's path */
 @property (nonatomic, copy, readonly) NSString *path;
 
+/*! YES if route's handler may be executed on a worker queue concurrently with other requests. NO if it is bound to the main queue */
+@property (nonatomic, assign, readonly) BOOL isConcurrent;
+
+/*! Latency statistics of route's requests. Shared by all routes with the same verb and path */
+@property (nonatomic, strong, readonly, nullable) FBRouteMetrics *metrics;
+
 /**
  Convenience constructor for GET route with given pathPattern
  */
@@ -63,6 +70,12 @@ typedef __nonnull id<FBResponsePayload> (^FBRouteSyncHandler)(FBRouteRequest *re
  */
 - (instancetype)withoutSession;
 
+/**
+ Chain-able constructor for route, which neither touches XCTest nor the UI state,
+ so it is safe to execute it concurrently with other requests off the main queue
+ */
+- (instancetype)concurrent;
+
 /**
  Dispatches response for request
  */
@@ -11,17 +11,25 @@
 #import "FBRouteRequest-Private.h"
 
 #import <objc/message.h>
+#import <RoutingHTTPServer/RouteResponse.h>
 
 #import "FBExceptionHandler.h"
+#import "FBHistogram.h"
 #import "FBResponsePayload.h"
+#import "FBRouteMetrics.h"
 #import "FBSession.h"
+#import "FBTrace.h"
 
 @interface FBRoute ()
 @property (nonatomic, assign, readwrite) BOOL requiresSession;
+@property (nonatomic, assign, readwrite) BOOL isConcurrent;
 @property (nonatomic, copy, readwrite) NSString *verb;
 @property (nonatomic, copy, readwrite) NSString *path;
+@property (nonatomic, strong, readwrite) FBRouteMetrics *metrics;
+@property (nonatomic, assign) const char *traceName;
 
 - (void)decorateRequest:(FBRouteRequest *)request;
+- (id<FBResponsePayload>)payloadForRequest:(FBRouteRequest *)request;
 
 @end
 
@@ -35,12 +43,10 @@ static NSString *const FBRouteSessionPrefix = @"/session/:sessionID";
 
 @implementation FBRoute_TargetAction
 
-- (void)mountRequest:(FBRouteRequest *)request intoResponse:(RouteResponse *)response
+- (id<FBResponsePayload>)payloadForRequest:(FBRouteRequest *)request
 {
-  [self decorateRequest:request];
   id<FBResponsePayload> (*requestMsgSend)(id, SEL, FBRouteRequest *) = ((id<FBResponsePayload>(*)(id, SEL, FBRouteRequest *))objc_msgSend);
-  id<FBResponsePayload> payload = requestMsgSend(self.target, self.action, request);
-  [payload dispatchWithResponse:response];
+  return requestMsgSend(self.target, self.action, request);
 }
 
 @end
@@ -53,11 +59,9 @@ static NSString *const FBRouteSessionPrefix = @"/session/:sessionID";
 
 @implementation FBRoute_Sync
 
-- (void)mountRequest:(FBRouteRequest *)request intoResponse:(RouteResponse *)response
+- (id<FBResponsePayload>)payloadForRequest:(FBRouteRequest *)request
 {
-  [self decorateRequest:request];
-  id<FBResponsePayload> payload = self.handler(request);
-  [payload dispatchWithResponse:response];
+  return self.handler(request);
 }
 
 @end
@@ -118,18 +122,30 @@ static NSString *const FBRouteSessionPrefix = @"/session/:sessionID";
   return self;
 }
 
+- (instancetype)concurrent
+{
+  self.isConcurrent = YES;
+  return self;
+}
+
 - (instancetype)respondWithBlock:(FBRouteSyncHandler)handler
 {
   FBRoute_Sync *route = [FBRoute_Sync withVerb:self.verb path:self.path requiresSession:self.requiresSession];
+  route.isConcurrent = self.isConcurrent;
   route.handler = handler;
+  route.metrics = [FBRouteMetrics metricsForVerb:route.verb path:route.path];
+  route.traceName = FBTraceInternName([NSString stringWithFormat:@"%@ %@", route.verb, route.path]);
   return route;
 }
 
 - (instancetype)respondWithTarget:(id)target action:(SEL)action
 {
   FBRoute_TargetAction *route = [FBRoute_TargetAction withVerb:self.verb path:self.path requiresSession:self.requiresSession];
+  route.isConcurrent = self.isConcurrent;
   route.target = target;
   route.action = action;
+  route.metrics = [FBRouteMetrics metricsForVerb:route.verb path:route.path];
+  route.traceName = FBTraceInternName([NSString stringWithFormat:@"%@ %@", route.verb, route.path]);
   return route;
 }
 
@@ -158,7 +174,40 @@ static NSString *const FBRouteSessionPrefix = @"/session/:sessionID";
 
 - (void)mountRequest:(FBRouteRequest *)request intoResponse:(RouteResponse *)response
 {
-  [FBResponseWithErrorFormat(@"Unhandled route") dispatchWithResponse:response];
+  NSUInteger initialResolveCount = FBRouteMetricsResolveCount();
+  NSTimeInterval handlerStart = [NSProcessInfo processInfo].systemUptime;
+  const char *traceName = self.traceName ?: "Unhandled route";
+  FBTraceSetCurrentRequestID(FBTraceNextRequestID());
+  FBTraceBegin(traceName);
+  __block id<FBResponsePayload> payload;
+  @try {
+    [self decorateRequest:request];
+    if (request.session) {
+      [request.session performAsCurrentSession:^{
+        payload = [self payloadForRequest:request];
+      }];
+    } else {
+      payload = [self payloadForRequest:request];
+    }
+  }
+  @finally {
+    FBTraceEnd(traceName);
+  }
+  NSTimeInterval encodeStart = [NSProcessInfo processInfo].systemUptime;
+  [self.metrics.handlerDuration recordValue:encodeStart - handlerStart];
+  [self.metrics.resolveCount recordValue:FBRouteMetricsResolveCount() - initialResolveCount];
+
+  [payload dispatchWithResponse:response];
+  [self.metrics.encodeDuration recordValue:[NSProcessInfo processInfo].systemUptime - encodeStart];
+  if ([response isKindOfClass:RouteResponse.class]) {
+    [self.metrics.responseSize recordValue:response.response.contentLength];
+  }
+  FBTraceSetCurrentRequestID(0);
+}
+
+- (id<FBResponsePayload>)payloadForRequest:(FBRouteRequest *)request
+{
+  return FBResponseWithErrorFormat(@"Unhandled route");
 }
 
 @end
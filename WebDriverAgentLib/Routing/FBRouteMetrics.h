@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <Foundation/Foundation.h>
+
+@class FBHistogram;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Records that an element has been resolved by the request handled on the current thread
+ */
+void FBRouteMetricsCountResolve(void);
+
+/**
+ Returns the count of element resolutions recorded on the current thread
+ */
+NSUInteger FBRouteMetricsResolveCount(void);
+
+/**
+ Records that a request has been matched to a route and is waiting for its queue
+ */
+void FBRouteMetricsRequestQueued(void);
+
+/**
+ Records that the handling of a request recorded with FBRouteMetricsRequestQueued has started
+ */
+void FBRouteMetricsRequestStarted(void);
+
+/**
+ Records that the handling of a request started with FBRouteMetricsRequestStarted has finished
+ */
+void FBRouteMetricsRequestFinished(void);
+
+/**
+ Returns the count of requests, which are waiting for their queue
+ */
+NSUInteger FBRouteMetricsQueuedRequestsCount(void);
+
+/**
+ Returns the count of requests, which are being handled
+ */
+NSUInteger FBRouteMetricsInFlightRequestsCount(void);
+
+/**
+ Returns the count of requests, which are waiting for their queue or are being handled
+ */
+NSUInteger FBRouteMetricsPendingRequestsCount(void);
+
+/**
+ Latency and size statistics of requests handled by the routes with the same verb and path pattern
+ */
+@interface FBRouteMetrics : NSObject
+
+/*! Route's verb */
+@property (nonatomic, copy, readonly) NSString *verb;
+
+/*! Route's path pattern */
+@property (nonatomic, copy, readonly) NSString *path;
+
+/*! Time spent parsing request arguments, seconds */
+@property (nonatomic, strong, readonly) FBHistogram *parseDuration;
+
+/*! Time spent in the route handler, seconds */
+@property (nonatomic, strong, readonly) FBHistogram *handlerDuration;
+
+/*! Count of element resolutions made by the route handler */
+@property (nonatomic, strong, readonly) FBHistogram *resolveCount;
+
+/*! Time spent encoding the response payload, seconds */
+@property (nonatomic, strong, readonly) FBHistogram *encodeDuration;
+
+/*! Size of the response body, bytes */
+@property (nonatomic, strong, readonly) FBHistogram *responseSize;
+
+/**
+ Returns metrics shared by all routes with the given verb and path pattern
+
+ @param verb route's verb
+ @param path route's path pattern
+ @return metrics instance or nil if verb or path are not set
+ */
++ (nullable instancetype)metricsForVerb:(nullable NSString *)verb path:(nullable NSString *)path;
+
+/**
+ Renders metrics of all routes, which have handled at least one request,
+ in Prometheus text exposition format
+ */
++ (NSString *)prometheusText;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,176 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import "FBRouteMetrics.h"
+
+#import <stdatomic.h>
+
+#import "FBHistogram.h"
+
+static _Thread_local NSUInteger FBCurrentThreadResolveCount = 0;
+static atomic_uint_fast64_t FBQueuedRequestsCount = 0;
+static atomic_uint_fast64_t FBInFlightRequestsCount = 0;
+
+void FBRouteMetricsCountResolve(void)
+{
+  FBCurrentThreadResolveCount++;
+}
+
+NSUInteger FBRouteMetricsResolveCount(void)
+{
+  return FBCurrentThreadResolveCount;
+}
+
+void FBRouteMetricsRequestQueued(void)
+{
+  atomic_fetch_add(&FBQueuedRequestsCount, 1);
+}
+
+void FBRouteMetricsRequestStarted(void)
+{
+  atomic_fetch_sub(&FBQueuedRequestsCount, 1);
+  atomic_fetch_add(&FBInFlightRequestsCount, 1);
+}
+
+void FBRouteMetricsRequestFinished(void)
+{
+  atomic_fetch_sub(&FBInFlightRequestsCount, 1);
+}
+
+NSUInteger FBRouteMetricsQueuedRequestsCount(void)
+{
+  return (NSUInteger)atomic_load(&FBQueuedRequestsCount);
+}
+
+NSUInteger FBRouteMetricsInFlightRequestsCount(void)
+{
+  return (NSUInteger)atomic_load(&FBInFlightRequestsCount);
+}
+
+NSUInteger FBRouteMetricsPendingRequestsCount(void)
+{
+  return FBRouteMetricsQueuedRequestsCount() + FBRouteMetricsInFlightRequestsCount();
+}
+
+static NSArray<NSNumber *> *FBDurationBuckets(void)
+{
+  return @[@0.001, @0.0025, @0.005, @0.01, @0.025, @0.05, @0.1, @0.25, @0.5, @1, @2.5, @5, @10, @30, @60];
+}
+
+static NSArray<NSNumber *> *FBResolveCountBuckets(void)
+{
+  return @[@0, @1, @2, @5, @10, @20, @50, @100];
+}
+
+static NSArray<NSNumber *> *FBResponseSizeBuckets(void)
+{
+  return @[@256, @1024, @4096, @16384, @65536, @262144, @1048576, @4194304, @16777216];
+}
+
+@interface FBRouteMetrics ()
+@property (nonatomic, copy, readwrite) NSString *verb;
+@property (nonatomic, copy, readwrite) NSString *path;
+@property (nonatomic, strong, readwrite) FBHistogram *parseDuration;
+@property (nonatomic, strong, readwrite) FBHistogram *handlerDuration;
+@property (nonatomic, strong, readwrite) FBHistogram *resolveCount;
+@property (nonatomic, strong, readwrite) FBHistogram *encodeDuration;
+@property (nonatomic, strong, readwrite) FBHistogram *responseSize;
+@end
+
+@implementation FBRouteMetrics
+
++ (NSMutableDictionary<NSString *, FBRouteMetrics *> *)registry
+{
+  static NSMutableDictionary<NSString *, FBRouteMetrics *> *registry;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    registry = [NSMutableDictionary dictionary];
+  });
+  return registry;
+}
+
++ (instancetype)metricsForVerb:(NSString *)verb path:(NSString *)path
+{
+  if (nil == verb || nil == path) {
+    return nil;
+  }
+  NSString *key = [NSString stringWithFormat:@"%@ %@", verb, path];
+  NSMutableDictionary<NSString *, FBRouteMetrics *> *registry = self.registry;
+  @synchronized (registry) {
+    FBRouteMetrics *metrics = registry[key];
+    if (nil == metrics) {
+      metrics = [[self alloc] initWithVerb:verb path:path];
+      registry[key] = metrics;
+    }
+    return metrics;
+  }
+}
+
+- (instancetype)initWithVerb:(NSString *)verb path:(NSString *)path
+{
+  self = [super init];
+  if (self) {
+    _verb = [verb copy];
+    _path = [path copy];
+    _parseDuration = [[FBHistogram alloc] initWithBucketBounds:FBDurationBuckets()];
+    _handlerDuration = [[FBHistogram alloc] initWithBucketBounds:FBDurationBuckets()];
+    _resolveCount = [[FBHistogram alloc] initWithBucketBounds:FBResolveCountBuckets()];
+    _encodeDuration = [[FBHistogram alloc] initWithBucketBounds:FBDurationBuckets()];
+    _responseSize = [[FBHistogram alloc] initWithBucketBounds:FBResponseSizeBuckets()];
+  }
+  return self;
+}
+
++ (NSString *)prometheusText
+{
+  NSArray<FBRouteMetrics *> *allMetrics;
+  NSMutableDictionary<NSString *, FBRouteMetrics *> *registry = self.registry;
+  @synchronized (registry) {
+    allMetrics = [registry.allValues sortedArrayUsingComparator:^NSComparisonResult(FBRouteMetrics *first, FBRouteMetrics *second) {
+      NSComparisonResult result = [first.path compare:second.path];
+      return result == NSOrderedSame ? [first.verb compare:second.verb] : result;
+    }];
+  }
+  NSMutableArray<FBRouteMetrics *> *usedMetrics = [NSMutableArray array];
+  for (FBRouteMetrics *metrics in allMetrics) {
+    if (metrics.handlerDuration.count > 0) {
+      [usedMetrics addObject:metrics];
+    }
+  }
+
+  NSMutableString *text = [NSMutableString string];
+  NSArray<NSArray *> *families = @[
+    @[@"wda_request_parse_seconds", @"Time spent parsing request arguments", NSStringFromSelector(@selector(parseDuration))],
+    @[@"wda_request_handler_seconds", @"Time spent in route handlers", NSStringFromSelector(@selector(handlerDuration))],
+    @[@"wda_request_resolves", @"Count of element resolutions made by route handlers", NSStringFromSelector(@selector(resolveCount))],
+    @[@"wda_response_encode_seconds", @"Time spent encoding response payloads", NSStringFromSelector(@selector(encodeDuration))],
+    @[@"wda_response_bytes", @"Size of response bodies", NSStringFromSelector(@selector(responseSize))],
+  ];
+  for (NSArray *family in families) {
+    NSString *name = family[0];
+    [text appendFormat:@"# HELP %@ %@\n# TYPE %@ histogram\n", name, family[1], name];
+    for (FBRouteMetrics *metrics in usedMetrics) {
+      FBHistogram *histogram = [metrics valueForKey:family[2]];
+      NSString *labels = [NSString stringWithFormat:@"method=\"%@\",route=\"%@\"", [self.class escapedLabelValue:metrics.verb], [self.class escapedLabelValue:metrics.path]];
+      [text appendString:[histogram prometheusSamplesWithName:name labels:labels]];
+    }
+  }
+  [text appendFormat:@"# HELP wda_requests_queued Count of requests waiting for their route queue\n# TYPE wda_requests_queued gauge\nwda_requests_queued %lu\n", (unsigned long)FBRouteMetricsQueuedRequestsCount()];
+  [text appendFormat:@"# HELP wda_requests_in_flight Count of requests being handled\n# TYPE wda_requests_in_flight gauge\nwda_requests_in_flight %lu\n", (unsigned long)FBRouteMetricsInFlightRequestsCount()];
+  return text.copy;
+}
+
++ (NSString *)escapedLabelValue:(NSString *)value
+{
+  return [[[value stringByReplacingOccurrencesOfString:@"\\" withString:@"\\\\"]
+           stringByReplacingOccurrencesOfString:@"\"" withString:@"\\\""]
+          stringByReplacingOccurrencesOfString:@"\n" withString:@"\\n"];
+}
+
+@end
@@ -0,0 +1,58 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Result of matching a request path against route patterns
+ */
+@interface FBRouteMatch : NSObject
+
+/*! The value registered for the matched pattern */
+@property (nonatomic, strong, readonly) id value;
+
+/*! Values of ':param' segments keyed by parameter names. The remainder matched by trailing '*' is stored as a single item array under 'wildcards' key */
+@property (nonatomic, copy, readonly) NSDictionary<NSString *, id> *parameters;
+
+@end
+
+/**
+ Route table compiled into a trie keyed by verb and path segments.
+ Matching time depends on the count of path segments instead of the count of registered routes.
+ Literal segments take precedence over ':param' segments, which take precedence over trailing '*'.
+ If the same pattern is registered more than once, the first registered value wins.
+ */
+@interface FBRouteTrie : NSObject
+
+/*! Verbs having at least one registered pattern */
+@property (nonatomic, copy, readonly) NSArray<NSString *> *verbs;
+
+/**
+ Registers value for the given verb and path pattern
+
+ @param value the value returned on successful match
+ @param verb HTTP verb, eg. 'GET'
+ @param pathPattern path pattern, eg. '/session/:sessionID/element/:uuid/click' or '/*'. '*' is only supported as the last segment
+ */
+- (void)addValue:(id)value forVerb:(NSString *)verb pathPattern:(NSString *)pathPattern;
+
+/**
+ Finds the value registered for the pattern matching the given path
+
+ @param verb HTTP verb, eg. 'GET'
+ @param path request path, eg. '/session/123/element/456/click'
+ @return match or nil if no pattern matches the path
+ */
+- (nullable FBRouteMatch *)matchVerb:(NSString *)verb path:(NSString *)path;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,187 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import "FBRouteTrie.h"
+
+static NSString *const FBRouteWildcardSegment = @"*";
+static NSString *const FBRouteWildcardsParameter = @"wildcards";
+
+@interface FBRouteMatch ()
+@property (nonatomic, strong, readwrite) id value;
+@property (nonatomic, copy, readwrite) NSDictionary<NSString *, id> *parameters;
+@end
+
+@implementation FBRouteMatch
+@end
+
+
+/**
+ Value registered for a pattern together with the names of its ':param' segments
+ */
+@interface FBRouteTrieEntry : NSObject
+@property (nonatomic, strong) id value;
+@property (nonatomic, copy) NSArray<NSString *> *parameterNames;
+@end
+
+@implementation FBRouteTrieEntry
+@end
+
+
+@interface FBRouteTrieNode : NSObject
+@property (nonatomic, strong) NSMutableDictionary<NSString *, FBRouteTrieNode *> *literalChildren;
+@property (nonatomic, strong) FBRouteTrieNode *parameterChild;
+@property (nonatomic, strong) FBRouteTrieEntry *entry;
+@property (nonatomic, strong) FBRouteTrieEntry *wildcardEntry;
+@end
+
+@implementation FBRouteTrieNode
+
+- (instancetype)init
+{
+  self = [super init];
+  if (self) {
+    _literalChildren = [NSMutableDictionary dictionary];
+  }
+  return self;
+}
+
+@end
+
+
+@interface FBRouteTrie ()
+@property (nonatomic, strong) NSMutableDictionary<NSString *, FBRouteTrieNode *> *roots;
+@end
+
+@implementation FBRouteTrie
+
+- (instancetype)init
+{
+  self = [super init];
+  if (self) {
+    _roots = [NSMutableDictionary dictionary];
+  }
+  return self;
+}
+
+- (NSArray<NSString *> *)verbs
+{
+  return [self.roots.allKeys sortedArrayUsingSelector:@selector(compare:)];
+}
+
+- (void)addValue:(id)value forVerb:(NSString *)verb pathPattern:(NSString *)pathPattern
+{
+  FBRouteTrieNode *node = self.roots[verb];
+  if (nil == node) {
+    node = [FBRouteTrieNode new];
+    self.roots[verb] = node;
+  }
+  NSArray<NSString *> *segments = [self.class segmentsOfPath:pathPattern];
+  NSMutableArray<NSString *> *parameterNames = [NSMutableArray array];
+  FBRouteTrieEntry *entry = [FBRouteTrieEntry new];
+  entry.value = value;
+  for (NSUInteger index = 0; index < segments.count; index++) {
+    NSString *segment = segments[index];
+    if ([segment isEqualToString:FBRouteWildcardSegment]) {
+      NSAssert(index == segments.count - 1, @"'*' is only supported as the last segment of '%@'", pathPattern);
+      entry.parameterNames = parameterNames;
+      if (nil == node.wildcardEntry) {
+        node.wildcardEntry = entry;
+      }
+      return;
+    }
+    if ([segment hasPrefix:@":"]) {
+      [parameterNames addObject:[segment substringFromIndex:1]];
+      if (nil == node.parameterChild) {
+        node.parameterChild = [FBRouteTrieNode new];
+      }
+      node = node.parameterChild;
+      continue;
+    }
+    FBRouteTrieNode *child = node.literalChildren[segment];
+    if (nil == child) {
+      child = [FBRouteTrieNode new];
+      node.literalChildren[segment] = child;
+    }
+    node = child;
+  }
+  entry.parameterNames = parameterNames;
+  if (nil == node.entry) {
+    node.entry = entry;
+  }
+}
+
+- (FBRouteMatch *)matchVerb:(NSString *)verb path:(NSString *)path
+{
+  FBRouteTrieNode *root = self.roots[verb];
+  if (nil == root) {
+    return nil;
+  }
+  NSArray<NSString *> *segments = [self.class segmentsOfPath:path];
+  NSMutableArray<NSString *> *parameterValues = [NSMutableArray array];
+  return [self matchSegments:segments fromIndex:0 node:root parameterValues:parameterValues];
+}
+
+#pragma mark - Private
+
+- (FBRouteMatch *)matchSegments:(NSArray<NSString *> *)segments fromIndex:(NSUInteger)index node:(FBRouteTrieNode *)node parameterValues:(NSMutableArray<NSString *> *)parameterValues
+{
+  if (index == segments.count && nil != node.entry) {
+    return [self.class matchWithEntry:node.entry parameterValues:parameterValues wildcard:nil];
+  }
+  if (index < segments.count) {
+    FBRouteTrieNode *literalChild = node.literalChildren[segments[index]];
+    if (nil != literalChild) {
+      FBRouteMatch *match = [self matchSegments:segments fromIndex:index + 1 node:literalChild parameterValues:parameterValues];
+      if (nil != match) {
+        return match;
+      }
+    }
+    if (nil != node.parameterChild) {
+      [parameterValues addObject:segments[index]];
+      FBRouteMatch *match = [self matchSegments:segments fromIndex:index + 1 node:node.parameterChild parameterValues:parameterValues];
+      if (nil != match) {
+        return match;
+      }
+      [parameterValues removeLastObject];
+    }
+  }
+  if (nil != node.wildcardEntry) {
+    NSString *wildcard = [[segments subarrayWithRange:NSMakeRange(index, segments.count - index)] componentsJoinedByString:@"/"];
+    return [self.class matchWithEntry:node.wildcardEntry parameterValues:parameterValues wildcard:wildcard];
+  }
+  return nil;
+}
+
++ (FBRouteMatch *)matchWithEntry:(FBRouteTrieEntry *)entry parameterValues:(NSArray<NSString *> *)parameterValues wildcard:(NSString *)wildcard
+{
+  NSMutableDictionary<NSString *, id> *parameters = [NSMutableDictionary dictionary];
+  for (NSUInteger index = 0; index < entry.parameterNames.count; index++) {
+    parameters[entry.parameterNames[index]] = parameterValues[index];
+  }
+  if (nil != wildcard) {
+    parameters[FBRouteWildcardsParameter] = @[wildcard];
+  }
+  FBRouteMatch *match = [FBRouteMatch new];
+  match.value = entry.value;
+  match.parameters = parameters;
+  return match;
+}
+
++ (NSArray<NSString *> *)segmentsOfPath:(NSString *)path
+{
+  NSMutableArray<NSString *> *segments = [NSMutableArray array];
+  for (NSString *segment in [path componentsSeparatedByString:@"/"]) {
+    if (segment.length > 0) {
+      [segments addObject:segment];
+    }
+  }
+  return segments.copy;
+}
+
+@end
@@ -0,0 +1,71 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <UIKit/UIKit.h>
+
+#import <WebDriverAgentLib/FBResponsePayload.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Returns encoded image of the current screen state or nil if it cannot be captured
+ */
+typedef NSData *_Nullable (^FBScreenStreamFrameSource)(void);
+
+/**
+ Long-lived response, which pushes JPEG frames as multipart/x-mixed-replace (MJPEG) stream.
+ Frames are captured on a dedicated serial queue. If the client has not received
+ the previous frame yet, the next capture is skipped, so slow clients always get the most recent state.
+ */
+@interface FBScreenStream : NSObject <FBResponsePayload>
+
+/*! Multipart boundary used to separate frames */
+@property (nonatomic, copy, readonly) NSString *boundary;
+
+/*! The count of frames skipped because of slow capture or slow client */
+@property (atomic, assign, readonly) NSUInteger skippedFramesCount;
+
+/**
+ Creates the stream
+
+ @param frameSource the block used to capture frames. It is called on the capture queue
+ @param framesPerSecond the maximum frame rate
+ @param scalingFactor frames scaling factor in range (0, 1]
+ @param compressionQuality JPEG compression quality in range (0, 1]
+ */
+- (instancetype)initWithFrameSource:(FBScreenStreamFrameSource)frameSource framesPerSecond:(NSUInteger)framesPerSecond scalingFactor:(CGFloat)scalingFactor compressionQuality:(CGFloat)compressionQuality;
+
+/**
+ Starts capturing frames. Is called automatically once the stream is dispatched as response
+ */
+- (void)start;
+
+/**
+ Stops capturing frames and finishes the response. Is called automatically once the client disconnects
+ */
+- (void)stop;
+
+/**
+ Returns the most recent captured frame wrapped into multipart envelope, which has not been consumed yet,
+ or nil if there is no such frame
+ */
+- (nullable NSData *)nextFrameData;
+
+/**
+ Wraps the JPEG data into the multipart envelope
+
+ @param jpegData the JPEG image data
+ @param boundary multipart boundary
+ @return the multipart part data including the leading boundary line
+ */
++ (NSData *)multipartFrameWithJpegData:(NSData *)jpegData boundary:(NSString *)boundary;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,207 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import "FBScreenStream.h"
+
+#import <RoutingHTTPServer/HTTPConnection.h>
+#import <RoutingHTTPServer/HTTPResponse.h>
+#import <RoutingHTTPServer/RouteResponse.h>
+
+#import "FBFramePacer.h"
+#import "FBImageUtils.h"
+
+@interface FBScreenStream () <HTTPResponse>
+
+@property (nonatomic, copy, readonly) FBScreenStreamFrameSource frameSource;
+@property (nonatomic, assign, readonly) CGFloat scalingFactor;
+@property (nonatomic, assign, readonly) CGFloat compressionQuality;
+@property (nonatomic, strong, readonly) FBFramePacer *pacer;
+@property (nonatomic, strong, readonly) dispatch_queue_t captureQueue;
+@property (atomic, assign, readwrite) NSUInteger skippedFramesCount;
+@property (atomic, assign) BOOL isActive;
+@property (atomic, weak) HTTPConnection *connection;
+@property (nonatomic, strong, nullable) NSData *pendingFrame;
+@property (nonatomic, strong, nullable) NSData *sendingFrame;
+@property (nonatomic, assign) NSUInteger sendingFrameOffset;
+@property (nonatomic, assign) UInt64 sentBytesCount;
+
+@end
+
+@implementation FBScreenStream
+
+- (instancetype)initWithFrameSource:(FBScreenStreamFrameSource)frameSource framesPerSecond:(NSUInteger)framesPerSecond scalingFactor:(CGFloat)scalingFactor compressionQuality:(CGFloat)compressionQuality
+{
+  self = [super init];
+  if (self) {
+    _frameSource = [frameSource copy];
+    _scalingFactor = scalingFactor;
+    _compressionQuality = compressionQuality;
+    _pacer = [[FBFramePacer alloc] initWithFramesPerSecond:framesPerSecond];
+    _boundary = [NSString stringWithFormat:@"wda-frame-%@", [NSUUID UUID].UUIDString];
+    _captureQueue = dispatch_queue_create("com.facebook.wda.screenStream", DISPATCH_QUEUE_SERIAL);
+    dispatch_set_target_queue(_captureQueue, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0));
+  }
+  return self;
+}
+
++ (NSData *)multipartFrameWithJpegData:(NSData *)jpegData boundary:(NSString *)boundary
+{
+  NSString *header = [NSString stringWithFormat:@"--%@\r\nContent-Type: image/jpeg\r\nContent-Length: %lu\r\n\r\n", boundary, (unsigned long)jpegData.length];
+  NSMutableData *frame = [[header dataUsingEncoding:NSUTF8StringEncoding] mutableCopy];
+  [frame appendData:jpegData];
+  [frame appendData:(NSData *)[@"\r\n" dataUsingEncoding:NSUTF8StringEncoding]];
+  return frame.copy;
+}
+
+- (void)start
+{
+  if (self.isActive) {
+    return;
+  }
+  self.isActive = YES;
+  dispatch_async(self.captureQueue, ^{
+    [self captureNextFrame];
+  });
+}
+
+- (void)stop
+{
+  self.isActive = NO;
+  [self.connection responseHasAvailableData:self];
+}
+
+- (void)captureNextFrame
+{
+  if (!self.isActive) {
+    return;
+  }
+  BOOL isClientBehind;
+  @synchronized (self) {
+    isClientBehind = nil != self.pendingFrame;
+  }
+  if (isClientBehind) {
+    self.skippedFramesCount++;
+  } else {
+    [self captureFrame];
+  }
+  NSUInteger pacerSkippedFramesCount = self.pacer.skippedFramesCount;
+  NSTimeInterval delay = [self.pacer delayBeforeNextFrameAtTime:[NSProcessInfo processInfo].systemUptime];
+  self.skippedFramesCount += self.pacer.skippedFramesCount - pacerSkippedFramesCount;
+  dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC)), self.captureQueue, ^{
+    [self captureNextFrame];
+  });
+}
+
+- (void)captureFrame
+{
+  NSData *imageData = self.frameSource();
+  if (nil == imageData) {
+    return;
+  }
+  NSData *jpegData = FBConvertedImageData(imageData, FBImageMimeTypeJPEG, self.scalingFactor, self.compressionQuality);
+  if (nil == jpegData) {
+    return;
+  }
+  NSData *frame = [self.class multipartFrameWithJpegData:jpegData boundary:self.boundary];
+  @synchronized (self) {
+    self.pendingFrame = frame;
+  }
+  [self.connection responseHasAvailableData:self];
+}
+
+- (NSData *)nextFrameData
+{
+  @synchronized (self) {
+    NSData *frame = self.pendingFrame;
+    self.pendingFrame = nil;
+    return frame;
+  }
+}
+
+
+#pragma mark - FBResponsePayload
+
+- (void)dispatchWithResponse:(RouteResponse *)response
+{
+  self.connection = response.connection;
+  response.response = self;
+  [self start];
+}
+
+
+#pragma mark - HTTPResponse
+
+- (UInt64)contentLength
+{
+  // The length is unknown, since the response is chunked
+  return 0;
+}
+
+- (UInt64)offset
+{
+  return self.sentBytesCount;
+}
+
+- (void)setOffset:(UInt64)offset
+{
+  // Seeking is not supported by streams
+}
+
+- (NSData *)readDataOfLength:(NSUInteger)length
+{
+  if (nil == self.sendingFrame || self.sendingFrameOffset >= self.sendingFrame.length) {
+    self.sendingFrame = [self nextFrameData];
+    self.sendingFrameOffset = 0;
+    if (nil == self.sendingFrame) {
+      return nil;
+    }
+  }
+  NSRange range = NSMakeRange(self.sendingFrameOffset, MIN(length, self.sendingFrame.length - self.sendingFrameOffset));
+  self.sendingFrameOffset += range.length;
+  self.sentBytesCount += range.length;
+  return [self.sendingFrame subdataWithRange:range];
+}
+
+- (BOOL)isDone
+{
+  return !self.isActive;
+}
+
+- (BOOL)isAsynchronous
+{
+  return YES;
+}
+
+- (BOOL)isChunked
+{
+  return YES;
+}
+
+- (NSInteger)status
+{
+  return 200;
+}
+
+- (NSDictionary *)httpHeaders
+{
+  return
+  @{
+    @"Content-Type": [NSString stringWithFormat:@"multipart/x-mixed-replace; boundary=%@", self.boundary],
+    @"Cache-Control": @"no-cache, no-store, must-revalidate",
+    @"Pragma": @"no-cache",
+  };
+}
+
+- (void)connectionDidClose
+{
+  self.connection = nil;
+  self.isActive = NO;
+}
+
+@end
@@ -10,15 +10,19 @@
 #import <WebDriverAgentLib/FBSession.h>
 
 @class FBElementCache;
+@class FBScreenshotDiffer;
 
 NS_ASSUME_NONNULL_BEGIN
 
 @interface FBSession ()
 @property (nonatomic, copy, readwrite) NSString *identifier;
 @property (nonatomic, strong, readwrite) FBElementCache *elementCache;
+@property (nonatomic, strong, readwrite) FBScreenshotDiffer *screenshotDiffer;
+@property (nonatomic, copy, readwrite) NSDictionary<NSString *, id> *settings;
 
 /**
- Sets session as current session
+ Registers session and sets it as the active one.
+ Sessions of the same application created earlier are unregistered.
  */
 + (void)markSessionActive:(FBSession *)session;
 
@@ -11,6 +11,7 @@
 
 @class FBApplication;
 @class FBElementCache;
+@class FBScreenshotDiffer;
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -31,11 +32,34 @@ extern NSString *const FBApplicationCrashedException;
 /*! Element cache related to that session */
 @property (nonatomic, strong, readonly) FBElementCache *elementCache;
 
+/*! Previous screenshot state used for delta screenshots of that session */
+@property (nonatomic, strong, readonly) FBScreenshotDiffer *screenshotDiffer;
+
+/*! If set, the tested application is put to FBApplicationPool with that key instead of being terminated when the session is killed */
+@property (nonatomic, copy, nullable) NSString *applicationPoolKey;
+
+/*! Settings of that session overriding the global FBConfiguration ones while its requests are handled */
+@property (nonatomic, copy, readonly) NSDictionary<NSString *, id> *settings;
+
+/**
+ Returns the most recently created session.
+ Returns nil once that session is killed, even if older sessions are still alive. No session is created implicitly.
+ */
 + (nullable instancetype)activeSession;
 
+/**
+ Returns the session, which the request handled on the current thread belongs to
+ */
++ (nullable instancetype)currentSession;
+
+/**
+ Returns all sessions, which are still alive
+ */
++ (NSArray<FBSession *> *)allSessions;
+
 /**
  Fetches session for given identifier.
- If identifier doesn't match activeSession identifier, will return nil.
+ If there is no alive session with that identifier, will return nil.
 
  @param identifier Identifier for searched session
  @return session. Can return nil if session does not exists
@@ -50,11 +74,28 @@ extern NSString *const FBApplicationCrashedException;
  */
 + (instancetype)sessionWithApplication:(nullable FBApplication *)application;
 
+/**
+ Creates and saves new session for application
+
+ @param application The application that we want to create session for
+ @param settings The settings returned by FBConfiguration settingsWithCapabilities:
+ @return new session
+ */
++ (instancetype)sessionWithApplication:(nullable FBApplication *)application settings:(nullable NSDictionary<NSString *, id> *)settings;
+
 /**
  Kills application associated with that session and removes session
  */
 - (void)kill;
 
+/**
+ Performs the block on behalf of that session.
+ Responses created by the block are attributed to that session and its settings override the global ones.
+
+ @param block the block to perform
+ */
+- (void)performAsCurrentSession:(void (^)(void))block;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -13,8 +13,11 @@
 #import <objc/runtime.h>
 
 #import "FBApplication.h"
+#import "FBApplicationPool.h"
+#import "FBConfiguration.h"
 #import "FBElementCache.h"
 #import "FBMacros.h"
+#import "FBScreenshotDiffer.h"
 #import "FBSpringboardApplication.h"
 #import "XCAccessibilityElement.h"
 #import "XCAXClient_iOS.h"
@@ -22,6 +25,8 @@
 
 NSString *const FBApplicationCrashedException = @"FBApplicationCrashedException";
 
+static const NSUInteger FBScreenshotDifferTileSize = 32;
+
 @interface FBSession ()
 @property (nonatomic, strong, readwrite) FBApplication *testedApplication;
 @end
@@ -29,17 +34,49 @@ NSString *const FBApplicationCrashedException = @"FBApplicationCrashedException"
 @implementation FBSession
 
 static FBSession *_activeSession;
+static NSMutableDictionary<NSString *, FBSession *> *FBSessionsMapping;
+static _Thread_local __unsafe_unretained FBSession *FBCurrentSession;
+
++ (void)initialize
+{
+  if (self == FBSession.class) {
+    FBSessionsMapping = [NSMutableDictionary dictionary];
+  }
+}
+
 + (instancetype)activeSession
 {
-  return _activeSession ?: [FBSession sessionWithApplication:nil];
+  @synchronized (FBSessionsMapping) {
+    return _activeSession;
+  }
+}
+
++ (instancetype)currentSession
+{
+  return FBCurrentSession;
+}
+
++ (NSArray<FBSession *> *)allSessions
+{
+  @synchronized (FBSessionsMapping) {
+    return FBSessionsMapping.allValues;
+  }
 }
 
 + (void)markSessionActive:(FBSession *)session
 {
-  if (_activeSession && _activeSession.testedApplication.bundleID != session.testedApplication.bundleID) {
-    [_activeSession kill];
+  @synchronized (FBSessionsMapping) {
+    // Launching the application of the new session has replaced the process tested by the previous session
+    // of the same application, so the previous session cannot be used anymore
+    NSString *bundleID = session.testedApplication.bundleID;
+    for (FBSession *existingSession in FBSessionsMapping.allValues) {
+      if (bundleID && [existingSession.testedApplication.bundleID isEqualToString:bundleID]) {
+        [FBSessionsMapping removeObjectForKey:existingSession.identifier];
+      }
+    }
+    FBSessionsMapping[session.identifier] = session;
+    _activeSession = session;
   }
-  _activeSession = session;
 }
 
 + (instancetype)sessionWithIdentifier:(NSString *)identifier
@@ -47,26 +84,53 @@ static FBSession *_activeSession;
   if (!identifier) {
     return nil;
   }
-  if (![identifier isEqualToString:_activeSession.identifier]) {
-    return nil;
+  @synchronized (FBSessionsMapping) {
+    return FBSessionsMapping[identifier];
   }
-  return _activeSession;
 }
 
 + (instancetype)sessionWithApplication:(FBApplication *)application
+{
+  return [self sessionWithApplication:application settings:nil];
+}
+
++ (instancetype)sessionWithApplication:(FBApplication *)application settings:(NSDictionary<NSString *, id> *)settings
 {
   FBSession *session = [FBSession new];
   session.identifier = [[NSUUID UUID] UUIDString];
   session.testedApplication = application;
+  session.settings = settings ?: @{};
   session.elementCache = [FBElementCache new];
+  session.screenshotDiffer = [[FBScreenshotDiffer alloc] initWithTileSize:FBScreenshotDifferTileSize];
   [FBSession markSessionActive:session];
   return session;
 }
 
 - (void)kill
 {
-  [self.testedApplication terminate];
-  _activeSession = nil;
+  if (self.applicationPoolKey && self.testedApplication.running) {
+    [[FBApplicationPool sharedPool] checkinApplication:self.testedApplication withKey:self.applicationPoolKey];
+  } else {
+    [self.testedApplication terminate];
+  }
+  @synchronized (FBSessionsMapping) {
+    [FBSessionsMapping removeObjectForKey:self.identifier];
+    if (_activeSession == self) {
+      _activeSession = nil;
+    }
+  }
+}
+
+- (void)performAsCurrentSession:(void (^)(void))block
+{
+  FBSession *previousSession = FBCurrentSession;
+  FBCurrentSession = self;
+  @try {
+    [FBConfiguration performWithSettings:self.settings block:block];
+  }
+  @finally {
+    FBCurrentSession = previousSession;
+  }
 }
 
 - (FBApplication *)application
@@ -74,7 +138,17 @@ static FBSession *_activeSession;
   if (self.testedApplication && !self.testedApplication.running) {
     [[NSException exceptionWithName:FBApplicationCrashedException reason:@"Application is not running, possibly crashed" userInfo:nil] raise];
   }
-  return [FBApplication fb_activeApplication] ?: self.testedApplication;
+  FBApplication *activeApplication = [FBApplication fb_activeApplication];
+  if (!activeApplication || !self.testedApplication) {
+    return activeApplication ?: self.testedApplication;
+  }
+  // The foreground application might be tested by another session, which must not be mixed up with this one
+  for (FBSession *session in [FBSession allSessions]) {
+    if (session != self && session.testedApplication.processID == activeApplication.processID) {
+      return self.testedApplication;
+    }
+  }
+  return activeApplication;
 }
 
 @end
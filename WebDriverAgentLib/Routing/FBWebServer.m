@@ -12,21 +12,39 @@
 #import <RoutingHTTPServer/RoutingConnection.h>
 #import <RoutingHTTPServer/RoutingHTTPServer.h>
 
+#import "FBApplicationPool.h"
 #import "FBCommandHandler.h"
 #import "FBErrorBuilder.h"
 #import "FBExceptionHandler.h"
+#import "FBHistogram.h"
+#import "FBRouteMetrics.h"
 #import "FBRouteRequest.h"
+#import "FBRouteTrie.h"
 #import "FBRuntimeUtils.h"
 #import "FBSession.h"
 #import "FBUnknownCommands.h"
 #import "FBConfiguration.h"
 #import "FBLogger.h"
+#import "FBMainQueueWatchdog.h"
 
 #import "XCUIDevice+FBHelpers.h"
 
 static NSString *const FBServerURLBeginMarker = @"ServerURLHere->";
 static NSString *const FBServerURLEndMarker = @"<-ServerURLHere";
 
+static NSUncaughtExceptionHandler *FBPreviousUncaughtExceptionHandler;
+
+/**
+ Uncaught exceptions terminate the process with abort(), which skips the atexit handler writing pending log entries
+ */
+static void FBFlushLogsOnUncaughtException(NSException *exception)
+{
+  [FBLogger flush];
+  if (NULL != FBPreviousUncaughtExceptionHandler) {
+    FBPreviousUncaughtExceptionHandler(exception);
+  }
+}
+
 @interface FBHTTPConnection : RoutingConnection
 @end
 
@@ -44,6 +62,7 @@ static NSString *const FBServerURLEndMarker = @"<-ServerURLHere";
 @interface FBWebServer ()
 @property (nonatomic, strong) FBExceptionHandler *exceptionHandler;
 @property (nonatomic, strong) RoutingHTTPServer *server;
+@property (nonatomic, strong) dispatch_queue_t concurrentRouteQueue;
 @property (atomic, assign) BOOL keepAlive;
 @end
 
@@ -67,8 +86,11 @@ static NSString *const FBServerURLEndMarker = @"<-ServerURLHere";
 - (void)startServing
 {
   [FBLogger logFmt:@"Built at %s %s", __DATE__, __TIME__];
+  FBPreviousUncaughtExceptionHandler = NSGetUncaughtExceptionHandler();
+  NSSetUncaughtExceptionHandler(FBFlushLogsOnUncaughtException);
   self.exceptionHandler = [FBExceptionHandler new];
   [self startHTTPServer];
+  [[FBMainQueueWatchdog sharedWatchdog] start];
 
   self.keepAlive = YES;
   NSRunLoop *runLoop = [NSRunLoop mainRunLoop];
@@ -79,12 +101,14 @@ static NSString *const FBServerURLEndMarker = @"<-ServerURLHere";
 - (void)startHTTPServer
 {
   self.server = [[RoutingHTTPServer alloc] init];
-  [self.server setRouteQueue:dispatch_get_main_queue()];
+  // Route handlers are dispatched either to the main queue or to the concurrent queue depending on the route,
+  // so that long running UI commands do not block requests, which do not touch the UI
+  self.concurrentRouteQueue = dispatch_queue_create("com.facebook.wda.concurrentRoutes", DISPATCH_QUEUE_CONCURRENT);
   [self.server setDefaultHeader:@"Server" value:@"WebDriverAgent/1.0"];
   [self.server setConnectionClass:[FBHTTPConnection self]];
 
-  [self registerRouteHandlers:[self.class collectCommandHandlerClasses]];
   [self registerServerKeyRouteHandlers];
+  [self registerRouteHandlers:[[self.class collectCommandHandlerClasses] arrayByAddingObject:FBUnknownCommands.class]];
 
   NSRange serverPortRange = FBConfiguration.bindingPortRange;
   NSError *error;
@@ -104,6 +128,8 @@ static NSString *const FBServerURLEndMarker = @"<-ServerURLHere";
 
   if (!serverStarted) {
     [FBLogger logFmt:@"Last attempt to start web server failed with error %@", [error description]];
+    // abort() does not run atexit handlers, so pending log entries must be written explicitly
+    [FBLogger flush];
     abort();
   }
   [FBLogger logFmt:@"%@http://%@:%d%@", FBServerURLBeginMarker, [XCUIDevice sharedDevice].fb_wifiIPAddress ?: @"localhost", [self.server port], FBServerURLEndMarker];
@@ -111,7 +137,11 @@ static NSString *const FBServerURLEndMarker = @"<-ServerURLHere";
 
 - (void)stopServing
 {
-  [FBSession.activeSession kill];
+  for (FBSession *session in [FBSession allSessions]) {
+    [session kill];
+  }
+  [[FBApplicationPool sharedPool] drain];
+  [[FBMainQueueWatchdog sharedWatchdog] stop];
   if (self.server.isRunning) {
     [self.server stop:NO];
   }
@@ -143,27 +173,55 @@ static NSString *const FBServerURLEndMarker = @"<-ServerURLHere";
 
 - (void)registerRouteHandlers:(NSArray *)commandHandlerClasses
 {
+  // Routes are compiled once, so that each request is matched in a single trie lookup
+  // instead of probing every registered path pattern in order
+  FBRouteTrie *routeTrie = [FBRouteTrie new];
   for (Class<FBCommandHandler> commandHandler in commandHandlerClasses) {
     NSArray *routes = [commandHandler routes];
     for (FBRoute *route in routes) {
-      [self.server handleMethod:route.verb withPath:route.path block:^(RouteRequest *request, RouteResponse *response) {
-        NSDictionary *arguments = [NSJSONSerialization JSONObjectWithData:request.body options:NSJSONReadingMutableContainers error:NULL];
-        FBRouteRequest *routeParams = [FBRouteRequest
-          routeRequestWithURL:request.url
-          parameters:request.params
-          arguments:arguments ?: @{}
-        ];
-
-        [FBLogger verboseLog:routeParams.description];
-
+      [routeTrie addValue:route forVerb:route.verb pathPattern:route.path];
+    }
+  }
+  for (NSString *verb in routeTrie.verbs) {
+    [self.server handleMethod:verb withPath:@"/*" block:^(RouteRequest *request, RouteResponse *response) {
+      FBRouteMatch *match = [routeTrie matchVerb:verb path:request.url.path];
+      if (nil == match) {
+        [FBResponseWithStatus(FBCommandStatusUnsupported, [NSString stringWithFormat:@"Unhandled endpoint: %@", request.url]) dispatchWithResponse:response];
+        return;
+      }
+      FBRoute *route = match.value;
+      NSTimeInterval parseStart = [NSProcessInfo processInfo].systemUptime;
+      NSMutableDictionary *parameters = request.params.mutableCopy;
+      [parameters removeObjectForKey:@"wildcards"];
+      [parameters addEntriesFromDictionary:match.parameters];
+
+      NSDictionary *arguments = [NSJSONSerialization JSONObjectWithData:request.body options:NSJSONReadingMutableContainers error:NULL];
+      FBRouteRequest *routeParams = [FBRouteRequest
+        routeRequestWithURL:request.url
+        parameters:parameters.copy
+        arguments:arguments ?: @{}
+      ];
+      [route.metrics.parseDuration recordValue:[NSProcessInfo processInfo].systemUptime - parseStart];
+
+      FBLogStructured(FBLogLevelVerbose, @"Handling request", @{
+        @"method": verb,
+        @"path": request.url.path ?: @"",
+        @"parameters": routeParams.parameters,
+        @"arguments": routeParams.arguments,
+      });
+
+      FBRouteMetricsRequestQueued();
+      dispatch_sync(route.isConcurrent ? self.concurrentRouteQueue : dispatch_get_main_queue(), ^{
+        FBRouteMetricsRequestStarted();
         @try {
           [route mountRequest:routeParams intoResponse:response];
         }
         @catch (NSException *exception) {
           [self handleException:exception forResponse:response];
         }
-      }];
-    }
+      });
+      FBRouteMetricsRequestFinished();
+    }];
   }
 }
 
@@ -184,10 +242,10 @@ static NSString *const FBServerURLEndMarker = @"<-ServerURLHere";
 
   [self.server get:@"/wda/shutdown" withBlock:^(RouteRequest *request, RouteResponse *response) {
     [response respondWithString:@"Shutting down"];
-    [self.delegate webServerDidRequestShutdown:self];
+    dispatch_async(dispatch_get_main_queue(), ^{
+      [self.delegate webServerDidRequestShutdown:self];
+    });
   }];
-
-  [self registerRouteHandlers:@[FBUnknownCommands.class]];
 }
 
 @end
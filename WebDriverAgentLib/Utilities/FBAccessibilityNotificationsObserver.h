@@ -0,0 +1,42 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Types of observed accessibility notifications (values of kAXScreenChangedNotification and kAXLayoutChangedNotification)
+ */
+typedef NS_ENUM(int, FBAccessibilityNotificationType) {
+  FBAccessibilityNotificationTypeScreenChanged = 1000,
+  FBAccessibilityNotificationTypeLayoutChanged = 1001,
+};
+
+/*! Posted for each accessibility notification delivered to XCTest, on the thread delivering it */
+extern NSString *const FBAccessibilityNotificationReceivedNotification;
+
+/*! The key of the notification user info containing accessibility notification type as NSNumber */
+extern NSString *const FBAccessibilityNotificationTypeKey;
+
+/**
+ Forwards accessibility notifications, which are received by XCTest, to the default notification center
+ */
+@interface FBAccessibilityNotificationsObserver : NSObject
+
+/**
+ Starts forwarding accessibility notifications. Subsequent calls do nothing.
+
+ @return YES if screen and layout change notifications are going to be delivered
+ */
++ (BOOL)startObserving;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,66 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import "FBAccessibilityNotificationsObserver.h"
+
+#import <objc/runtime.h>
+
+#import "FBLogger.h"
+#import "XCAXClient_iOS.h"
+
+NSString *const FBAccessibilityNotificationReceivedNotification = @"FBAccessibilityNotificationReceivedNotification";
+NSString *const FBAccessibilityNotificationTypeKey = @"type";
+
+@implementation FBAccessibilityNotificationsObserver
+
++ (BOOL)startObserving
+{
+  static BOOL isObserving = NO;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    isObserving = [self forwardNotifications] && [self registerForNotifications];
+    if (!isObserving) {
+      [FBLogger log:@"Accessibility notifications are not available"];
+    }
+  });
+  return isObserving;
+}
+
++ (BOOL)forwardNotifications
+{
+  SEL selector = @selector(handleAccessibilityNotification:withPayload:);
+  Method method = class_getInstanceMethod(NSClassFromString(@"XCAXClient_iOS"), selector);
+  if (!method) {
+    return NO;
+  }
+  static IMP originalImplementation;
+  IMP implementation = imp_implementationWithBlock(^(id client, int notification, id payload) {
+    [[NSNotificationCenter defaultCenter] postNotificationName:FBAccessibilityNotificationReceivedNotification
+                                                        object:nil
+                                                      userInfo:@{FBAccessibilityNotificationTypeKey: @(notification)}];
+    ((void (*)(id, SEL, int, id))originalImplementation)(client, selector, notification, payload);
+  });
+  originalImplementation = method_setImplementation(method, implementation);
+  return YES;
+}
+
++ (BOOL)registerForNotifications
+{
+  XCAXClient_iOS *client = [XCAXClient_iOS sharedClient];
+  NSError *error;
+  for (NSNumber *notification in @[@(FBAccessibilityNotificationTypeScreenChanged), @(FBAccessibilityNotificationTypeLayoutChanged)]) {
+    if (![client _registerForAXNotification:notification.intValue error:&error]) {
+      [FBLogger logFmt:@"Failed to register for accessibility notification %@: %@", notification, error.description];
+      return NO;
+    }
+  }
+  return YES;
+}
+
+@end
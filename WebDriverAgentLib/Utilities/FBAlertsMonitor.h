@@ -0,0 +1,63 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <Foundation/Foundation.h>
+
+@class XCUIElement;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Performs the actual alert lookup and returns alert element or nil if there is no alert
+ */
+typedef XCUIElement * _Nullable (^FBAlertsMonitorLookup)(void);
+
+/**
+ Keeps track of alerts presence, so subsequent alert checks do not have to query the accessibility tree.
+ The cached state is dropped as soon as the screen reports an accessibility change, after an event
+ is synthesized by WebDriverAgent or after the cache timeout, whatever happens first.
+ */
+@interface FBAlertsMonitor : NSObject
+
+/*! YES if the monitor receives accessibility notifications */
+@property (nonatomic, assign, readonly) BOOL isObservingNotifications;
+
+/*! Maximum age of the cached alert state in seconds */
+@property (nonatomic, assign) NSTimeInterval cacheTimeout;
+
+/**
+ Returns the shared monitor, which observes accessibility notifications of the device
+ */
++ (instancetype)sharedMonitor;
+
+/**
+ Returns alert element of the application with the given bundle identifier
+
+ @param bundleID the bundle identifier of the application
+ @param lookup the block performing the actual lookup, called only if there is no valid cached state
+ @return alert element or nil if there is no alert
+ */
+- (nullable XCUIElement *)alertElementForApplicationWithBundleID:(NSString *)bundleID lookup:(FBAlertsMonitorLookup)lookup;
+
+/**
+ Returns the time the cached alert state of the application has been looked up at
+
+ @param bundleID the bundle identifier of the application
+ @return system uptime in seconds or nil if there is no valid cached state
+ */
+- (nullable NSNumber *)lookupTimestampOfApplicationWithBundleID:(NSString *)bundleID;
+
+/**
+ Drops the cached alert state of all applications
+ */
+- (void)invalidate;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,119 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import "FBAlertsMonitor.h"
+
+#import "FBAccessibilityNotificationsObserver.h"
+
+// Without notifications appearing alerts can only be noticed by querying again
+static const NSTimeInterval FBAlertsCacheTimeoutWithNotifications = 5.0;
+static const NSTimeInterval FBAlertsCacheTimeoutWithoutNotifications = 1.0;
+
+@interface FBAlertsMonitorEntry : NSObject
+@property (nonatomic, strong, nullable) XCUIElement *alertElement;
+@property (nonatomic, assign) NSTimeInterval timestamp;
+@property (nonatomic, assign) NSTimeInterval lookupFinishTimestamp;
+@end
+
+@implementation FBAlertsMonitorEntry
+@end
+
+@interface FBAlertsMonitor ()
+@property (nonatomic, assign, readwrite) BOOL isObservingNotifications;
+@property (nonatomic, strong) NSMutableDictionary<NSString *, FBAlertsMonitorEntry *> *entries;
+@property (nonatomic, assign) NSUInteger generation;
+@end
+
+@implementation FBAlertsMonitor
+
++ (instancetype)sharedMonitor
+{
+  static FBAlertsMonitor *monitor;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    monitor = [FBAlertsMonitor new];
+    [monitor startObservingNotifications];
+  });
+  return monitor;
+}
+
+- (instancetype)init
+{
+  self = [super init];
+  if (self) {
+    _entries = [NSMutableDictionary dictionary];
+    _cacheTimeout = FBAlertsCacheTimeoutWithoutNotifications;
+  }
+  return self;
+}
+
+- (void)startObservingNotifications
+{
+  if (![FBAccessibilityNotificationsObserver startObserving]) {
+    return;
+  }
+  __weak FBAlertsMonitor *weakSelf = self;
+  [[NSNotificationCenter defaultCenter] addObserverForName:FBAccessibilityNotificationReceivedNotification
+                                                    object:nil
+                                                     queue:nil
+                                                usingBlock:^(NSNotification *notification) {
+    [weakSelf invalidate];
+  }];
+  self.isObservingNotifications = YES;
+  self.cacheTimeout = FBAlertsCacheTimeoutWithNotifications;
+}
+
+- (XCUIElement *)alertElementForApplicationWithBundleID:(NSString *)bundleID lookup:(FBAlertsMonitorLookup)lookup
+{
+  NSTimeInterval now = [NSProcessInfo processInfo].systemUptime;
+  NSUInteger generation;
+  @synchronized (self) {
+    FBAlertsMonitorEntry *entry = self.entries[bundleID];
+    if (entry && now - entry.timestamp < self.cacheTimeout) {
+      return entry.alertElement;
+    }
+    generation = self.generation;
+  }
+
+  XCUIElement *alertElement = lookup();
+
+  @synchronized (self) {
+    // The screen has changed while the lookup was running, so its result might be already outdated
+    if (generation == self.generation) {
+      FBAlertsMonitorEntry *entry = [FBAlertsMonitorEntry new];
+      entry.alertElement = alertElement;
+      entry.timestamp = now;
+      entry.lookupFinishTimestamp = [NSProcessInfo processInfo].systemUptime;
+      self.entries[bundleID] = entry;
+    }
+  }
+  return alertElement;
+}
+
+- (NSNumber *)lookupTimestampOfApplicationWithBundleID:(NSString *)bundleID
+{
+  NSTimeInterval now = [NSProcessInfo processInfo].systemUptime;
+  @synchronized (self) {
+    FBAlertsMonitorEntry *entry = self.entries[bundleID];
+    if (entry && now - entry.timestamp < self.cacheTimeout) {
+      return @(entry.lookupFinishTimestamp);
+    }
+  }
+  return nil;
+}
+
+- (void)invalidate
+{
+  @synchronized (self) {
+    self.generation++;
+    [self.entries removeAllObjects];
+  }
+}
+
+@end
@@ -0,0 +1,65 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <Foundation/Foundation.h>
+
+@class FBApplication;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Keeps launched applications running between sessions,
+ so that sessions with matching capabilities can reuse them instead of launching them again
+ */
+@interface FBApplicationPool : NSObject
+
+/*! The maximum count of applications kept in the pool. The least recently added ones are terminated first */
+@property (nonatomic, assign) NSUInteger capacity;
+
+/*! The count of applications kept in the pool */
+@property (nonatomic, assign, readonly) NSUInteger count;
+
+/**
+ Returns the pool shared by all sessions
+ */
++ (instancetype)sharedPool;
+
+/**
+ Returns the key identifying applications, which can be reused for the session with the given capabilities.
+ Applications match if they have the same bundle identifier, path, launch arguments, launch environment and quiescence setting.
+
+ @param capabilities desired capabilities of the session
+ @return the key to be used for checkout and checkin
+ */
++ (NSString *)keyWithCapabilities:(NSDictionary *)capabilities;
+
+/**
+ Removes a running application with the given key from the pool
+
+ @param key the key returned by keyWithCapabilities:
+ @return the application or nil if there is no running application with that key
+ */
+- (nullable FBApplication *)checkoutApplicationWithKey:(NSString *)key;
+
+/**
+ Puts a running application to the pool
+
+ @param application the application to keep running
+ @param key the key returned by keyWithCapabilities:
+ */
+- (void)checkinApplication:(FBApplication *)application withKey:(NSString *)key;
+
+/**
+ Terminates all applications kept in the pool
+ */
+- (void)drain;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import "FBApplicationPool.h"
+
+#import "FBApplication.h"
+
+static const NSUInteger FBApplicationPoolDefaultCapacity = 2;
+
+@interface FBApplicationPoolEntry : NSObject
+@property (nonatomic, copy) NSString *key;
+@property (nonatomic, strong) FBApplication *application;
+@end
+
+@implementation FBApplicationPoolEntry
+@end
+
+@interface FBApplicationPool ()
+@property (nonatomic, strong) NSMutableArray<FBApplicationPoolEntry *> *entries;
+@end
+
+@implementation FBApplicationPool
+
++ (instancetype)sharedPool
+{
+  static FBApplicationPool *pool;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    pool = [FBApplicationPool new];
+  });
+  return pool;
+}
+
+- (instancetype)init
+{
+  self = [super init];
+  if (self) {
+    _entries = [NSMutableArray array];
+    _capacity = FBApplicationPoolDefaultCapacity;
+  }
+  return self;
+}
+
++ (NSString *)keyWithCapabilities:(NSDictionary *)capabilities
+{
+  NSMutableArray<NSString *> *components = [NSMutableArray array];
+  [components addObject:[NSString stringWithFormat:@"bundleId=%@", capabilities[@"bundleId"] ?: @""]];
+  [components addObject:[NSString stringWithFormat:@"app=%@", capabilities[@"app"] ?: @""]];
+  [components addObject:[NSString stringWithFormat:@"shouldWaitForQuiescence=%d", [capabilities[@"shouldWaitForQuiescence"] boolValue]]];
+  for (NSString *argument in (NSArray *)capabilities[@"arguments"] ?: @[]) {
+    [components addObject:[NSString stringWithFormat:@"argument=%@", argument]];
+  }
+  NSDictionary *environment = capabilities[@"environment"] ?: @{};
+  for (NSString *name in [environment.allKeys sortedArrayUsingSelector:@selector(compare:)]) {
+    [components addObject:[NSString stringWithFormat:@"environment=%@=%@", name, environment[name]]];
+  }
+  return [components componentsJoinedByString:@"\n"];
+}
+
+- (NSUInteger)count
+{
+  return self.entries.count;
+}
+
+- (FBApplication *)checkoutApplicationWithKey:(NSString *)key
+{
+  for (FBApplicationPoolEntry *entry in self.entries.copy) {
+    if (![entry.key isEqualToString:key]) {
+      continue;
+    }
+    [self.entries removeObject:entry];
+    // The application might have crashed or might have been terminated since it has been added
+    if (entry.application.running) {
+      return entry.application;
+    }
+  }
+  return nil;
+}
+
+- (void)checkinApplication:(FBApplication *)application withKey:(NSString *)key
+{
+  FBApplicationPoolEntry *entry = [FBApplicationPoolEntry new];
+  entry.key = key;
+  entry.application = application;
+  [self.entries addObject:entry];
+  while (self.entries.count > self.capacity) {
+    [self.entries.firstObject.application terminate];
+    [self.entries removeObjectAtIndex:0];
+  }
+}
+
+- (void)drain
+{
+  for (FBApplicationPoolEntry *entry in self.entries) {
+    [entry.application terminate];
+  }
+  [self.entries removeAllObjects];
+}
+
+@end
@@ -34,6 +34,28 @@ NS_ASSUME_NONNULL_BEGIN
 + (void)setMaxTypingFrequency:(NSUInteger)value;
 + (NSUInteger)maxTypingFrequency;
 
+/*! If set to YES, typing starts with a high frequency and slows down to maxTypingFrequency only if typed text does not match */
++ (void)setShouldUseAdaptiveTypingFrequency:(BOOL)value;
++ (BOOL)shouldUseAdaptiveTypingFrequency;
+
+/**
+ Extracts settings, which can be customized per session, from session capabilities.
+ Supported keys are shouldUseTestManagerForVisibilityDetection, shouldUseCompactResponses,
+ maxTypingFrequency and shouldUseAdaptiveTypingFrequency.
+
+ @param capabilities desired capabilities of the session
+ @return settings to be passed to performWithSettings:block:
+ */
++ (NSDictionary<NSString *, id> *)settingsWithCapabilities:(NSDictionary *)capabilities;
+
+/**
+ Performs the block with the given settings overriding the global ones on the current thread
+
+ @param settings settings returned by settingsWithCapabilities:
+ @param block the block to perform
+ */
++ (void)performWithSettings:(nullable NSDictionary<NSString *, id> *)settings block:(void (^)(void))block;
+
 /**
  The range of ports that the HTTP Server should attempt to bind on launch
  */
@@ -20,6 +20,16 @@ static NSUInteger const DefaultPortRange = 100;
 static BOOL FBShouldUseTestManagerForVisibilityDetection = NO;
 static BOOL FBShouldUseCompactResponses = YES;
 static NSUInteger FBMaxTypingFrequency = 60;
+static BOOL FBShouldUseAdaptiveTypingFrequency = NO;
+
+static NSString *const FBSettingShouldUseTestManagerForVisibilityDetection = @"shouldUseTestManagerForVisibilityDetection";
+static NSString *const FBSettingShouldUseCompactResponses = @"shouldUseCompactResponses";
+static NSString *const FBSettingMaxTypingFrequency = @"maxTypingFrequency";
+static NSString *const FBSettingShouldUseAdaptiveTypingFrequency = @"shouldUseAdaptiveTypingFrequency";
+
+// Settings of the session, which the request handled on the current thread belongs to.
+// The dictionary is retained by performWithSettings:block: for as long as it is set
+static _Thread_local __unsafe_unretained NSDictionary<NSString *, id> *FBCurrentSettings;
 
 @implementation FBConfiguration
 
@@ -56,6 +66,32 @@ static NSUInteger FBMaxTypingFrequency = 60;
   return [NSProcessInfo.processInfo.environment[@"VERBOSE_LOGGING"] boolValue];
 }
 
++ (NSDictionary<NSString *, id> *)settingsWithCapabilities:(NSDictionary *)capabilities
+{
+  NSMutableDictionary<NSString *, id> *settings = [NSMutableDictionary dictionary];
+  settings[FBSettingShouldUseTestManagerForVisibilityDetection] = @([capabilities[FBSettingShouldUseTestManagerForVisibilityDetection] boolValue]);
+  if (capabilities[FBSettingShouldUseCompactResponses]) {
+    settings[FBSettingShouldUseCompactResponses] = @([capabilities[FBSettingShouldUseCompactResponses] boolValue]);
+  }
+  if (capabilities[FBSettingMaxTypingFrequency]) {
+    settings[FBSettingMaxTypingFrequency] = @([capabilities[FBSettingMaxTypingFrequency] integerValue]);
+  }
+  settings[FBSettingShouldUseAdaptiveTypingFrequency] = @([capabilities[FBSettingShouldUseAdaptiveTypingFrequency] boolValue]);
+  return settings.copy;
+}
+
++ (void)performWithSettings:(NSDictionary<NSString *, id> *)settings block:(void (^)(void))block
+{
+  NSDictionary<NSString *, id> *previousSettings = FBCurrentSettings;
+  FBCurrentSettings = settings;
+  @try {
+    block();
+  }
+  @finally {
+    FBCurrentSettings = previousSettings;
+  }
+}
+
 + (void)setShouldUseTestManagerForVisibilityDetection:(BOOL)value
 {
   FBShouldUseTestManagerForVisibilityDetection = value;
@@ -63,7 +99,8 @@ static NSUInteger FBMaxTypingFrequency = 60;
 
 + (BOOL)shouldUseTestManagerForVisibilityDetection
 {
-  return FBShouldUseTestManagerForVisibilityDetection;
+  NSNumber *value = FBCurrentSettings[FBSettingShouldUseTestManagerForVisibilityDetection];
+  return value ? value.boolValue : FBShouldUseTestManagerForVisibilityDetection;
 }
 
 + (void)setShouldUseCompactResponses:(BOOL)value
@@ -73,7 +110,8 @@ static NSUInteger FBMaxTypingFrequency = 60;
 
 + (BOOL)shouldUseCompactResponses
 {
-  return FBShouldUseCompactResponses;
+  NSNumber *value = FBCurrentSettings[FBSettingShouldUseCompactResponses];
+  return value ? value.boolValue : FBShouldUseCompactResponses;
 }
 
 + (void)setMaxTypingFrequency:(NSUInteger)value
@@ -83,7 +121,19 @@ static NSUInteger FBMaxTypingFrequency = 60;
 
 + (NSUInteger)maxTypingFrequency
 {
-  return FBMaxTypingFrequency;
+  NSNumber *value = FBCurrentSettings[FBSettingMaxTypingFrequency];
+  return value ? value.unsignedIntegerValue : FBMaxTypingFrequency;
+}
+
++ (void)setShouldUseAdaptiveTypingFrequency:(BOOL)value
+{
+  FBShouldUseAdaptiveTypingFrequency = value;
+}
+
++ (BOOL)shouldUseAdaptiveTypingFrequency
+{
+  NSNumber *value = FBCurrentSettings[FBSettingShouldUseAdaptiveTypingFrequency];
+  return value ? value.boolValue : FBShouldUseAdaptiveTypingFrequency;
 }
 
 #pragma mark Private
@@ -0,0 +1,45 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Schedules frames at a constant rate.
+ If a frame takes longer than its interval, the missed time slots are skipped
+ instead of being captured in a burst.
+ */
+@interface FBFramePacer : NSObject
+
+/*! The interval between two subsequent frames in seconds */
+@property (nonatomic, assign, readonly) NSTimeInterval frameInterval;
+
+/*! The count of time slots skipped so far */
+@property (nonatomic, assign, readonly) NSUInteger skippedFramesCount;
+
+/**
+ Creates pacer with the given frame rate
+
+ @param framesPerSecond the expected count of frames per second. Must be greater than zero
+ */
+- (instancetype)initWithFramesPerSecond:(NSUInteger)framesPerSecond;
+
+/**
+ Returns the delay before the next frame should be captured.
+ The first call returns zero, so the first frame is captured immediately.
+
+ @param now the current time in seconds, for example system uptime
+ @return the delay in seconds
+ */
+- (NSTimeInterval)delayBeforeNextFrameAtTime:(NSTimeInterval)now;
+
+@end
+
+NS_ASSUME_NONNULL_END
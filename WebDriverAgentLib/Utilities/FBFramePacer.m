@@ -0,0 +1,47 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import "FBFramePacer.h"
+
+@interface FBFramePacer ()
+@property (nonatomic, assign, readwrite) NSUInteger skippedFramesCount;
+@property (nonatomic, assign) NSTimeInterval nextFrameTime;
+@property (nonatomic, assign) BOOL isStarted;
+@end
+
+@implementation FBFramePacer
+
+- (instancetype)initWithFramesPerSecond:(NSUInteger)framesPerSecond
+{
+  NSParameterAssert(framesPerSecond > 0);
+  self = [super init];
+  if (self) {
+    _frameInterval = 1.0 / MAX(framesPerSecond, 1);
+  }
+  return self;
+}
+
+- (NSTimeInterval)delayBeforeNextFrameAtTime:(NSTimeInterval)now
+{
+  if (!self.isStarted) {
+    self.isStarted = YES;
+    self.nextFrameTime = now;
+    return 0;
+  }
+  self.nextFrameTime += self.frameInterval;
+  if (self.nextFrameTime >= now) {
+    return self.nextFrameTime - now;
+  }
+  NSUInteger missedFramesCount = (NSUInteger)floor((now - self.nextFrameTime) / self.frameInterval);
+  self.skippedFramesCount += missedFramesCount;
+  self.nextFrameTime += missedFramesCount * self.frameInterval;
+  return 0;
+}
+
+@end
@@ -0,0 +1,56 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Histogram with fixed buckets. Values are recorded with atomic operations only,
+ so recording never blocks and can be done from any thread.
+ */
+@interface FBHistogram : NSObject
+
+/*! Ascending upper bounds of the buckets. Values greater than the last bound are only counted in the total count */
+@property (nonatomic, copy, readonly) NSArray<NSNumber *> *bucketBounds;
+
+/*! The count of recorded values */
+@property (nonatomic, assign, readonly) uint64_t count;
+
+/*! The sum of recorded values */
+@property (nonatomic, assign, readonly) double sum;
+
+/**
+ Creates histogram with the given buckets
+
+ @param bucketBounds ascending upper bounds of the buckets
+ */
+- (instancetype)initWithBucketBounds:(NSArray<NSNumber *> *)bucketBounds;
+
+/**
+ Records the value
+ */
+- (void)recordValue:(double)value;
+
+/**
+ Returns the count of values less than or equal to each of bucket bounds
+ */
+- (NSArray<NSNumber *> *)cumulativeBucketCounts;
+
+/**
+ Renders bucket, sum and count samples of the histogram in Prometheus text exposition format
+
+ @param name the metric family name
+ @param labels comma separated label pairs added to each sample or nil if there are no labels
+ */
+- (NSString *)prometheusSamplesWithName:(NSString *)name labels:(nullable NSString *)labels;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,112 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import "FBHistogram.h"
+
+#import <stdatomic.h>
+
+@interface FBHistogram ()
+{
+  double *_bounds;
+  NSUInteger _boundsCount;
+  _Atomic(uint64_t) *_bucketCounts;
+  _Atomic(uint64_t) _count;
+  // Bits of the double value, so that it can be updated with compare-and-swap
+  _Atomic(uint64_t) _sumBits;
+}
+@end
+
+@implementation FBHistogram
+
+- (instancetype)initWithBucketBounds:(NSArray<NSNumber *> *)bucketBounds
+{
+  self = [super init];
+  if (self) {
+    _bucketBounds = [bucketBounds copy];
+    _boundsCount = bucketBounds.count;
+    _bounds = calloc(MAX(_boundsCount, 1), sizeof(double));
+    _bucketCounts = calloc(MAX(_boundsCount, 1), sizeof(_Atomic(uint64_t)));
+    for (NSUInteger index = 0; index < _boundsCount; index++) {
+      _bounds[index] = bucketBounds[index].doubleValue;
+      atomic_init(&_bucketCounts[index], 0);
+    }
+    atomic_init(&_count, 0);
+    double zero = 0;
+    uint64_t zeroBits;
+    memcpy(&zeroBits, &zero, sizeof(zeroBits));
+    atomic_init(&_sumBits, zeroBits);
+  }
+  return self;
+}
+
+- (void)dealloc
+{
+  free(_bounds);
+  free(_bucketCounts);
+}
+
+- (void)recordValue:(double)value
+{
+  for (NSUInteger index = 0; index < _boundsCount; index++) {
+    if (value <= _bounds[index]) {
+      atomic_fetch_add_explicit(&_bucketCounts[index], 1, memory_order_relaxed);
+      break;
+    }
+  }
+  atomic_fetch_add_explicit(&_count, 1, memory_order_relaxed);
+  uint64_t expectedBits = atomic_load_explicit(&_sumBits, memory_order_relaxed);
+  uint64_t desiredBits;
+  do {
+    double sum;
+    memcpy(&sum, &expectedBits, sizeof(sum));
+    sum += value;
+    memcpy(&desiredBits, &sum, sizeof(desiredBits));
+  } while (!atomic_compare_exchange_weak_explicit(&_sumBits, &expectedBits, desiredBits, memory_order_relaxed, memory_order_relaxed));
+}
+
+- (uint64_t)count
+{
+  return atomic_load_explicit(&_count, memory_order_relaxed);
+}
+
+- (double)sum
+{
+  uint64_t bits = atomic_load_explicit(&_sumBits, memory_order_relaxed);
+  double sum;
+  memcpy(&sum, &bits, sizeof(sum));
+  return sum;
+}
+
+- (NSArray<NSNumber *> *)cumulativeBucketCounts
+{
+  NSMutableArray<NSNumber *> *result = [NSMutableArray arrayWithCapacity:_boundsCount];
+  uint64_t cumulativeCount = 0;
+  for (NSUInteger index = 0; index < _boundsCount; index++) {
+    cumulativeCount += atomic_load_explicit(&_bucketCounts[index], memory_order_relaxed);
+    [result addObject:@(cumulativeCount)];
+  }
+  return result.copy;
+}
+
+- (NSString *)prometheusSamplesWithName:(NSString *)name labels:(NSString *)labels
+{
+  NSString *labelsPrefix = labels.length > 0 ? [labels stringByAppendingString:@","] : @"";
+  NSString *labelsSet = labels.length > 0 ? [NSString stringWithFormat:@"{%@}", labels] : @"";
+  NSMutableString *text = [NSMutableString string];
+  NSArray<NSNumber *> *bucketCounts = self.cumulativeBucketCounts;
+  for (NSUInteger index = 0; index < bucketCounts.count; index++) {
+    [text appendFormat:@"%@_bucket{%@le=\"%@\"} %@\n", name, labelsPrefix, self.bucketBounds[index].stringValue, bucketCounts[index]];
+  }
+  [text appendFormat:@"%@_bucket{%@le=\"+Inf\"} %llu\n", name, labelsPrefix, self.count];
+  [text appendFormat:@"%@_sum%@ %.6f\n", name, labelsSet, self.sum];
+  [text appendFormat:@"%@_count%@ %llu\n", name, labelsSet, self.count];
+  return text.copy;
+}
+
+@end
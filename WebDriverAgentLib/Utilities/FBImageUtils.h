@@ -0,0 +1,49 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/*! MIME type of PNG images */
+extern NSString *const FBImageMimeTypePNG;
+
+/*! MIME type of JPEG images */
+extern NSString *const FBImageMimeTypeJPEG;
+
+/*! Returns MIME type of the given image data based on its signature or nil if the format is unknown */
+NSString *_Nullable FBImageMimeType(NSData *imageData);
+
+/*! Returns PNG representation of the given image data. PNG data is returned as is */
+NSData *_Nullable FBToPngData(NSData *imageData);
+
+/**
+ Converts the image data into the given format.
+ The data is returned as is if it already has the requested format and neither scaling nor
+ compression is requested, so no decoding happens in that case.
+
+ @param imageData the source image data
+ @param mimeType either FBImageMimeTypePNG or FBImageMimeTypeJPEG
+ @param scalingFactor the image scaling factor in range (0, 1]
+ @param compressionQuality JPEG compression quality in range (0, 1]. Ignored for PNG
+ @return the converted data or nil if the source data cannot be decoded
+ */
+NSData *_Nullable FBConvertedImageData(NSData *imageData, NSString *mimeType, CGFloat scalingFactor, CGFloat compressionQuality);
+
+/**
+ Encodes the image into the given format
+
+ @param image the image to encode
+ @param mimeType either FBImageMimeTypePNG or FBImageMimeTypeJPEG
+ @param compressionQuality JPEG compression quality in range (0, 1]. Ignored for PNG
+ @return the encoded data or nil in case of failure
+ */
+NSData *_Nullable FBEncodedImageData(CGImageRef image, NSString *mimeType, CGFloat compressionQuality);
+
+NS_ASSUME_NONNULL_END
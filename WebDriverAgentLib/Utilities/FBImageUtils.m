@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import "FBImageUtils.h"
+
+#import <ImageIO/ImageIO.h>
+#import <MobileCoreServices/MobileCoreServices.h>
+
+NSString *const FBImageMimeTypePNG = @"image/png";
+NSString *const FBImageMimeTypeJPEG = @"image/jpeg";
+
+static const uint8_t FBPngSignature[] = {0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A};
+static const uint8_t FBJpegSignature[] = {0xFF, 0xD8, 0xFF};
+
+static BOOL FBImageHasSignature(NSData *imageData, const uint8_t *signature, NSUInteger signatureLength)
+{
+  return imageData.length >= signatureLength && 0 == memcmp(imageData.bytes, signature, signatureLength);
+}
+
+NSString *FBImageMimeType(NSData *imageData)
+{
+  if (FBImageHasSignature(imageData, FBPngSignature, sizeof(FBPngSignature))) {
+    return FBImageMimeTypePNG;
+  }
+  if (FBImageHasSignature(imageData, FBJpegSignature, sizeof(FBJpegSignature))) {
+    return FBImageMimeTypeJPEG;
+  }
+  return nil;
+}
+
+NSData *FBToPngData(NSData *imageData)
+{
+  return FBConvertedImageData(imageData, FBImageMimeTypePNG, 1.0, 1.0);
+}
+
+NSData *FBConvertedImageData(NSData *imageData, NSString *mimeType, CGFloat scalingFactor, CGFloat compressionQuality)
+{
+  BOOL isPng = [mimeType isEqualToString:FBImageMimeTypePNG];
+  BOOL shouldScale = scalingFactor > 0 && scalingFactor < 1.0;
+  BOOL shouldCompress = !isPng && compressionQuality > 0 && compressionQuality < 1.0;
+  if ([FBImageMimeType(imageData) isEqualToString:mimeType] && !shouldScale && !shouldCompress) {
+    return imageData;
+  }
+
+  CGImageSourceRef imageSource = CGImageSourceCreateWithData((__bridge CFDataRef)imageData, NULL);
+  if (NULL == imageSource) {
+    return nil;
+  }
+  CGImageRef image = NULL;
+  if (shouldScale) {
+    NSDictionary *properties = (__bridge_transfer NSDictionary *)CGImageSourceCopyPropertiesAtIndex(imageSource, 0, NULL);
+    CGFloat maxDimension = MAX([properties[(__bridge NSString *)kCGImagePropertyPixelWidth] doubleValue],
+                               [properties[(__bridge NSString *)kCGImagePropertyPixelHeight] doubleValue]);
+    // Thumbnail creation decodes the image directly into the smaller buffer
+    NSDictionary *thumbnailOptions = @{
+      (__bridge NSString *)kCGImageSourceCreateThumbnailFromImageAlways: @YES,
+      (__bridge NSString *)kCGImageSourceThumbnailMaxPixelSize: @(MAX(1, round(maxDimension * scalingFactor))),
+    };
+    image = CGImageSourceCreateThumbnailAtIndex(imageSource, 0, (__bridge CFDictionaryRef)thumbnailOptions);
+  } else {
+    image = CGImageSourceCreateImageAtIndex(imageSource, 0, NULL);
+  }
+  CFRelease(imageSource);
+  if (NULL == image) {
+    return nil;
+  }
+  NSData *result = FBEncodedImageData(image, mimeType, compressionQuality);
+  CGImageRelease(image);
+  return result;
+}
+
+NSData *FBEncodedImageData(CGImageRef image, NSString *mimeType, CGFloat compressionQuality)
+{
+  BOOL isPng = [mimeType isEqualToString:FBImageMimeTypePNG];
+  NSMutableData *result = [NSMutableData data];
+  CFStringRef imageType = isPng ? kUTTypePNG : kUTTypeJPEG;
+  CGImageDestinationRef destination = CGImageDestinationCreateWithData((__bridge CFMutableDataRef)result, imageType, 1, NULL);
+  if (NULL == destination) {
+    return nil;
+  }
+  NSDictionary *destinationOptions = isPng ? @{} : @{
+    (__bridge NSString *)kCGImageDestinationLossyCompressionQuality: @(compressionQuality > 0 ? compressionQuality : 1.0),
+  };
+  CGImageDestinationAddImage(destination, image, (__bridge CFDictionaryRef)destinationOptions);
+  BOOL isFinalized = CGImageDestinationFinalize(destination);
+  CFRelease(destination);
+  return isFinalized ? result.copy : nil;
+}
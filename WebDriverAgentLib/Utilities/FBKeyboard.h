@@ -40,6 +40,26 @@ NS_ASSUME_NONNULL_BEGIN
 */
 + (BOOL)typeText:(NSString *)text frequency:(NSUInteger)frequency error:(NSError **)error;
 
+/**
+ Removes the given count of characters around the cursor of active element and types a string
+ afterwards. Both steps are delivered as a single event stream, where removal is not limited by
+ the typing frequency. There must be element with keyboard focus; otherwise an error is raised.
+
+ @param count the count of characters to remove. Each of them is removed with backspace and forward
+ delete key pair, so the cursor position does not matter
+ @param text that should be typed after removal. Can be empty
+ @param frequency Frequency of typing the text (letters per sec)
+ @param error If there is an error, upon return contains an NSError object that describes the problem.
+ @return YES if the operation succeeds, otherwise NO.
+ */
++ (BOOL)clearCharactersCount:(NSUInteger)count andTypeText:(NSString *)text frequency:(NSUInteger)frequency error:(NSError **)error;
+
+/**
+ Notifies that keyboard focus has been moved to another element, so the keyboard might change its layout.
+ The next typing command will wait until the keyboard is stable, even if its frame has not changed yet.
+ */
++ (void)invalidateStableState;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -10,18 +10,33 @@
 #import "FBKeyboard.h"
 
 
+#import "FBAlertsMonitor.h"
 #import "FBApplication.h"
 #import "FBConfiguration.h"
 #import "FBXCTestDaemonsProxy.h"
 #import "FBErrorBuilder.h"
 #import "FBRunLoopSpinner.h"
+#import "FBTrace.h"
 #import "FBMacros.h"
+#import "FBMathUtils.h"
 #import "FBXCodeCompatibility.h"
 #import "XCElementSnapshot.h"
+#import "XCPointerEventPath.h"
+#import "XCSynthesizedEventRecord.h"
 #import "XCUIElement+FBUtilities.h"
 #import "XCTestDriver.h"
 #import "FBLogger.h"
-#import "FBConfiguration.h"
+
+static NSString *const FBBackspaceDeleteSequence = @"\b\x7F";
+/*! Frequency of removal keys. It is not limited by maxTypingFrequency, since there is nothing to autocorrect */
+static const NSUInteger FBClearTextFrequency = 300;
+/*! Time after which the keyboard stable state is not trusted anymore */
+static const NSTimeInterval FBKeyboardStableStateTimeout = 30.;
+
+/*! Keyboard state observed after the last successful stability wait */
+static CGRect FBLastStableKeyboardFrame;
+static pid_t FBLastStableKeyboardProcessID;
+static NSDate *FBLastStableKeyboardDate;
 
 
 @implementation FBKeyboard
@@ -38,6 +53,7 @@
   }
   __block BOOL didSucceed = NO;
   __block NSError *innerError;
+  FBTraceBegin("_XCT_sendString");
   [FBRunLoopSpinner spinUntilCompletion:^(void(^completion)(void)){
     [[FBXCTestDaemonsProxy testRunnerProxy]
      _XCT_sendString:text
@@ -48,22 +64,87 @@
        completion();
      }];
   }];
+  FBTraceEnd("_XCT_sendString");
+  [[FBAlertsMonitor sharedMonitor] invalidate];
   if (error) {
     *error = innerError;
   }
   return didSucceed;
 }
 
++ (BOOL)clearCharactersCount:(NSUInteger)count andTypeText:(NSString *)text frequency:(NSUInteger)frequency error:(NSError **)error
+{
+  NSString *clearSequence = [@"" stringByPaddingToLength:count * FBBackspaceDeleteSequence.length withString:FBBackspaceDeleteSequence startingAtIndex:0];
+  if (0 == clearSequence.length && 0 == text.length) {
+    return YES;
+  }
+  if (![XCPointerEventPath instancesRespondToSelector:@selector(initForTextInput)]) {
+    // Text input event paths are not available before Xcode 10, so the whole stream is sent with the typing frequency
+    return [self typeText:[clearSequence stringByAppendingString:text] frequency:frequency error:error];
+  }
+  if (![FBKeyboard waitUntilVisibleWithError:error]) {
+    return NO;
+  }
+  XCPointerEventPath *eventPath = [[XCPointerEventPath alloc] initForTextInput];
+  NSTimeInterval offset = 0;
+  if (clearSequence.length > 0) {
+    [eventPath typeText:clearSequence atOffset:offset typingSpeed:FBClearTextFrequency shouldRedact:NO];
+    offset += (NSTimeInterval)clearSequence.length / FBClearTextFrequency;
+  }
+  if (text.length > 0) {
+    [eventPath typeText:text atOffset:offset typingSpeed:frequency shouldRedact:NO];
+  }
+  FBApplication *application = [FBApplication fb_activeApplication];
+  XCSynthesizedEventRecord *event = [[XCSynthesizedEventRecord alloc] initWithName:@"Clear and type text" interfaceOrientation:application.interfaceOrientation];
+  [event addPointerEventPath:eventPath];
+  return [FBXCTestDaemonsProxy synthesizeEventWithRecord:event error:error];
+}
+
++ (void)invalidateStableState
+{
+  FBLastStableKeyboardDate = nil;
+}
+
 + (BOOL)waitUntilVisibleWithError:(NSError **)error
 {
   FBApplication *application = [FBApplication fb_activeApplication];
-  
+  if ([self isKeyboardSettledInApplication:application]) {
+    return YES;
+  }
+
   if (![application fb_waitUntilFrameIsStable]) {
     return
     [[[FBErrorBuilder builder]
       withDescription:@"Timeout waiting for keybord to stop animating"]
      buildError:error];
   }
+  XCUIElement *keyboard = application.keyboards.fb_firstMatch;
+  if (nil == keyboard) {
+    [self invalidateStableState];
+    return YES;
+  }
+  FBLastStableKeyboardFrame = keyboard.frame;
+  FBLastStableKeyboardProcessID = application.processID;
+  FBLastStableKeyboardDate = [NSDate date];
+  return YES;
+}
+
+/**
+ Keyboard is considered settled if it is shown in the same application with the same frame as after
+ the last stability wait and focus has not been moved since then
+ */
++ (BOOL)isKeyboardSettledInApplication:(FBApplication *)application
+{
+  if (nil == FBLastStableKeyboardDate
+      || -[FBLastStableKeyboardDate timeIntervalSinceNow] > FBKeyboardStableStateTimeout
+      || application.processID != FBLastStableKeyboardProcessID) {
+    return NO;
+  }
+  XCUIElement *keyboard = application.keyboards.fb_firstMatch;
+  if (nil == keyboard || !FBRectFuzzyEqualToRect(keyboard.frame, FBLastStableKeyboardFrame, FBDefaultFrameFuzzyThreshold)) {
+    return NO;
+  }
+  // The timeout is counted from the last real stability wait, so that a cached state is never trusted forever
   return YES;
 }
 
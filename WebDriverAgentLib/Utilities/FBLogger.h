@@ -12,7 +12,62 @@
 NS_ASSUME_NONNULL_BEGIN
 
 /**
- A Global Logger object that understands log levels
+ Log levels ordered by their verbosity
+ */
+typedef NS_ENUM(NSUInteger, FBLogLevel) {
+  FBLogLevelError = 0,
+  FBLogLevelWarning,
+  FBLogLevelInfo,
+  FBLogLevelVerbose,
+};
+
+/*! The most verbose level, which is currently logged. Use FBLogger setMinimumLevel: to change it */
+extern FBLogLevel FBLoggerMinimumLevel;
+
+/*! Returns YES if messages of the given level are currently logged */
+static inline BOOL FBLogLevelIsEnabled(FBLogLevel level)
+{
+  return level <= FBLoggerMinimumLevel;
+}
+
+/**
+ Logs the message with the given level and structured fields.
+ Neither the message nor the fields are evaluated if the level is disabled.
+ Example: FBLogStructured(FBLogLevelVerbose, @"Handling request", @{@"path": path});
+ */
+#define FBLogStructured(level, logMessage, ...) do { \
+  if (FBLogLevelIsEnabled(level)) { \
+    [FBLogger logWithLevel:(level) message:(logMessage) fields:__VA_ARGS__]; \
+  } \
+} while (0)
+
+/**
+ Single record of the log
+ */
+@interface FBLogEntry : NSObject
+
+/*! Time when the entry has been logged */
+@property (nonatomic, strong, readonly) NSDate *timestamp;
+
+/*! Log level of the entry */
+@property (nonatomic, assign, readonly) FBLogLevel level;
+
+/*! Log message */
+@property (nonatomic, copy, readonly) NSString *message;
+
+/*! Structured fields of the entry */
+@property (nonatomic, copy, readonly, nullable) NSDictionary<NSString *, id> *fields;
+
+/**
+ Returns JSON-compatible representation of the entry
+ */
+- (NSDictionary<NSString *, id> *)dictionaryRepresentation;
+
+@end
+
+/**
+ A Global Logger object that understands log levels.
+ Messages are written by a background writer, so logging never blocks the calling thread on I/O.
  */
 @interface FBLogger : NSObject
 
@@ -28,6 +83,32 @@ NS_ASSUME_NONNULL_BEGIN
 + (void)verboseLog:(NSString *)message;
 + (void)verboseLogFmt:(NSString *)format, ... NS_FORMAT_FUNCTION(1,2);
 
+/**
+ Logs the message with the given level and structured fields.
+ Prefer FBLogStructured macro, which skips evaluation of disabled messages.
+
+ @param level the level of the message
+ @param message the message to log
+ @param fields key-value pairs to attach to the message
+ */
++ (void)logWithLevel:(FBLogLevel)level message:(NSString *)message fields:(nullable NSDictionary<NSString *, id> *)fields;
+
+/**
+ Changes the most verbose level, which is logged.
+ It defaults to FBLogLevelVerbose if WDA is Verbose and to FBLogLevelInfo otherwise.
+ */
++ (void)setMinimumLevel:(FBLogLevel)level;
+
+/**
+ Blocks until all the messages logged so far are written
+ */
++ (void)flush;
+
+/**
+ Returns the most recent log entries ordered from the oldest to the newest
+ */
++ (NSArray<FBLogEntry *> *)recentEntries;
+
 @end
 
 NS_ASSUME_NONNULL_END
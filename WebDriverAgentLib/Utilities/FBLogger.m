@@ -9,40 +9,222 @@
 
 #import "FBLogger.h"
 
+#import <stdatomic.h>
+
 #import "FBConfiguration.h"
 
+FBLogLevel FBLoggerMinimumLevel = FBLogLevelInfo;
+
+/*! The count of the most recent entries kept in memory */
+static const NSUInteger FBLogRecentEntriesCapacity = 1000;
+
+/*! Node of the lock-free pending entries stack. Producers push nodes, the writer takes the whole stack at once */
+typedef struct FBLogNode {
+  struct FBLogNode *next;
+  void *entry;
+} FBLogNode;
+
+static _Atomic(FBLogNode *) FBLogPendingEntries = NULL;
+static dispatch_queue_t FBLogWriterQueue;
+static dispatch_source_t FBLogWriterSource;
+static void *FBLogWriterQueueKey = &FBLogWriterQueueKey;
+static NSMutableArray<FBLogEntry *> *FBLogRecentEntries;
+static NSUInteger FBLogNextRecentEntryIndex = 0;
+
+static NSString *FBLogLevelName(FBLogLevel level)
+{
+  switch (level) {
+    case FBLogLevelError:
+      return @"error";
+    case FBLogLevelWarning:
+      return @"warning";
+    case FBLogLevelInfo:
+      return @"info";
+    case FBLogLevelVerbose:
+      return @"verbose";
+  }
+  return @"unknown";
+}
+
+@interface FBLogEntry ()
+@property (nonatomic, strong, readwrite) NSDate *timestamp;
+@property (nonatomic, assign, readwrite) FBLogLevel level;
+@property (nonatomic, copy, readwrite) NSString *message;
+@property (nonatomic, copy, readwrite, nullable) NSDictionary<NSString *, id> *fields;
+@property (nonatomic, copy, readonly) NSString *formattedMessage;
+@end
+
+@implementation FBLogEntry
+
+- (NSDictionary<NSString *, id> *)dictionaryRepresentation
+{
+  NSMutableDictionary<NSString *, id> *fields = [NSMutableDictionary dictionary];
+  [self.fields enumerateKeysAndObjectsUsingBlock:^(NSString *key, id value, BOOL *stop) {
+    fields[key] = [NSJSONSerialization isValidJSONObject:@[value]] ? value : [value description];
+  }];
+  return
+  @{
+    @"timestamp": @(self.timestamp.timeIntervalSince1970),
+    @"level": FBLogLevelName(self.level),
+    @"message": self.message,
+    @"fields": fields.copy,
+  };
+}
+
+/**
+ Entries are written asynchronously, so the time and level of the entry itself are included
+ instead of relying on the time the message is written at
+ */
+- (NSString *)formattedMessage
+{
+  static NSDateFormatter *timestampFormatter;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    timestampFormatter = [NSDateFormatter new];
+    timestampFormatter.locale = [NSLocale localeWithLocaleIdentifier:@"en_US_POSIX"];
+    timestampFormatter.dateFormat = @"yyyy-MM-dd HH:mm:ss.SSS";
+  });
+  NSMutableString *formattedMessage = [NSMutableString stringWithFormat:@"[%@] [%@] %@", [timestampFormatter stringFromDate:self.timestamp], FBLogLevelName(self.level), self.message];
+  for (NSString *key in [self.fields.allKeys sortedArrayUsingSelector:@selector(compare:)]) {
+    [formattedMessage appendFormat:@" %@=%@", key, self.fields[key]];
+  }
+  return formattedMessage.copy;
+}
+
+@end
+
+static void FBLogWritePendingEntries(void)
+{
+  FBLogNode *node = atomic_exchange_explicit(&FBLogPendingEntries, NULL, memory_order_acquire);
+  // The stack contains the most recent entry first
+  FBLogNode *reversedNode = NULL;
+  while (NULL != node) {
+    FBLogNode *nextNode = node->next;
+    node->next = reversedNode;
+    reversedNode = node;
+    node = nextNode;
+  }
+  while (NULL != reversedNode) {
+    FBLogEntry *entry = (__bridge_transfer FBLogEntry *)reversedNode->entry;
+    NSLog(@"%@", entry.formattedMessage);
+    if (FBLogRecentEntries.count < FBLogRecentEntriesCapacity) {
+      [FBLogRecentEntries addObject:entry];
+    } else {
+      FBLogRecentEntries[FBLogNextRecentEntryIndex] = entry;
+    }
+    FBLogNextRecentEntryIndex = (FBLogNextRecentEntryIndex + 1) % FBLogRecentEntriesCapacity;
+    FBLogNode *nextNode = reversedNode->next;
+    free(reversedNode);
+    reversedNode = nextNode;
+  }
+}
+
+static void FBLogFlushAtExit(void)
+{
+  [FBLogger flush];
+}
+
 @implementation FBLogger
 
++ (void)load
+{
+  FBLoggerMinimumLevel = FBConfiguration.verboseLoggingEnabled ? FBLogLevelVerbose : FBLogLevelInfo;
+  FBLogRecentEntries = [NSMutableArray arrayWithCapacity:FBLogRecentEntriesCapacity];
+  FBLogWriterQueue = dispatch_queue_create("com.facebook.wda.logWriter", DISPATCH_QUEUE_SERIAL);
+  dispatch_queue_set_specific(FBLogWriterQueue, FBLogWriterQueueKey, FBLogWriterQueueKey, NULL);
+  FBLogWriterSource = dispatch_source_create(DISPATCH_SOURCE_TYPE_DATA_ADD, 0, 0, FBLogWriterQueue);
+  dispatch_source_set_event_handler(FBLogWriterSource, ^{
+    FBLogWritePendingEntries();
+  });
+  dispatch_resume(FBLogWriterSource);
+  atexit(FBLogFlushAtExit);
+}
+
 + (void)log:(NSString *)message
 {
-  NSLog(@"%@", message);
+  FBLogStructured(FBLogLevelInfo, message, nil);
 }
 
 + (void)logFmt:(NSString *)format, ...
 {
+  if (!FBLogLevelIsEnabled(FBLogLevelInfo)) {
+    return;
+  }
   va_list args;
   va_start(args, format);
-  NSLogv(format, args);
+  NSString *message = [[NSString alloc] initWithFormat:format arguments:args];
   va_end(args);
+  [self logWithLevel:FBLogLevelInfo message:message fields:nil];
 }
 
 + (void)verboseLog:(NSString *)message
 {
-  if (!FBConfiguration.verboseLoggingEnabled) {
-    return;
-  }
-  [self log:message];
+  FBLogStructured(FBLogLevelVerbose, message, nil);
 }
 
 + (void)verboseLogFmt:(NSString *)format, ...
 {
-  if (!FBConfiguration.verboseLoggingEnabled) {
+  if (!FBLogLevelIsEnabled(FBLogLevelVerbose)) {
     return;
   }
   va_list args;
   va_start(args, format);
-  NSLogv(format, args);
+  NSString *message = [[NSString alloc] initWithFormat:format arguments:args];
   va_end(args);
+  [self logWithLevel:FBLogLevelVerbose message:message fields:nil];
+}
+
++ (void)logWithLevel:(FBLogLevel)level message:(NSString *)message fields:(nullable NSDictionary<NSString *, id> *)fields
+{
+  if (!FBLogLevelIsEnabled(level)) {
+    return;
+  }
+  FBLogEntry *entry = [FBLogEntry new];
+  entry.timestamp = [NSDate date];
+  entry.level = level;
+  entry.message = message;
+  entry.fields = fields;
+
+  FBLogNode *node = malloc(sizeof(FBLogNode));
+  node->entry = (__bridge_retained void *)entry;
+  FBLogNode *head = atomic_load_explicit(&FBLogPendingEntries, memory_order_relaxed);
+  do {
+    node->next = head;
+  } while (!atomic_compare_exchange_weak_explicit(&FBLogPendingEntries, &head, node, memory_order_release, memory_order_relaxed));
+  dispatch_source_merge_data(FBLogWriterSource, 1);
+}
+
++ (void)setMinimumLevel:(FBLogLevel)level
+{
+  FBLoggerMinimumLevel = level;
+}
+
++ (void)flush
+{
+  // Flushing from the writer queue itself, e.g. when it raises, would dead-lock
+  if (NULL != dispatch_get_specific(FBLogWriterQueueKey)) {
+    FBLogWritePendingEntries();
+    return;
+  }
+  dispatch_sync(FBLogWriterQueue, ^{
+    FBLogWritePendingEntries();
+  });
+}
+
++ (NSArray<FBLogEntry *> *)recentEntries
+{
+  __block NSArray<FBLogEntry *> *entries;
+  dispatch_sync(FBLogWriterQueue, ^{
+    FBLogWritePendingEntries();
+    if (FBLogRecentEntries.count < FBLogRecentEntriesCapacity) {
+      entries = FBLogRecentEntries.copy;
+      return;
+    }
+    NSRange newestRange = NSMakeRange(0, FBLogNextRecentEntryIndex);
+    NSRange oldestRange = NSMakeRange(FBLogNextRecentEntryIndex, FBLogRecentEntriesCapacity - FBLogNextRecentEntryIndex);
+    entries = [[FBLogRecentEntries subarrayWithRange:oldestRange] arrayByAddingObjectsFromArray:[FBLogRecentEntries subarrayWithRange:newestRange]];
+  });
+  return entries;
 }
 
 @end
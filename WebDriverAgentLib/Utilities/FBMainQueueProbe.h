@@ -0,0 +1,30 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Measures how responsive the main queue is
+ */
+@interface FBMainQueueProbe : NSObject
+
+/**
+ Measures the time it takes the main queue to start a newly submitted block.
+ Must not be called on the main thread, zero is returned in that case.
+
+ @param timeout the maximum time to wait for the main queue in seconds
+ @return the latency in seconds or a negative value if the main queue has not started the block within the timeout
+ */
++ (NSTimeInterval)latencyWithTimeout:(NSTimeInterval)timeout;
+
+@end
+
+NS_ASSUME_NONNULL_END
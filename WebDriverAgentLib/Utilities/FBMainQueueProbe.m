@@ -0,0 +1,32 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import "FBMainQueueProbe.h"
+
+@implementation FBMainQueueProbe
+
++ (NSTimeInterval)latencyWithTimeout:(NSTimeInterval)timeout
+{
+  if ([NSThread isMainThread]) {
+    return 0;
+  }
+  dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
+  NSTimeInterval submitTime = [NSProcessInfo processInfo].systemUptime;
+  __block NSTimeInterval startTime = 0;
+  dispatch_async(dispatch_get_main_queue(), ^{
+    startTime = [NSProcessInfo processInfo].systemUptime;
+    dispatch_semaphore_signal(semaphore);
+  });
+  if (0 != dispatch_semaphore_wait(semaphore, dispatch_time(DISPATCH_TIME_NOW, (int64_t)(timeout * NSEC_PER_SEC)))) {
+    return -1;
+  }
+  return startTime - submitTime;
+}
+
+@end
@@ -0,0 +1,81 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <Foundation/Foundation.h>
+
+@class FBHistogram;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ A period of time the main queue did not start submitted blocks
+ */
+@interface FBMainQueueStall : NSObject <NSCopying>
+
+/*! Time the stall has been detected at, system uptime in seconds */
+@property (nonatomic, assign, readonly) NSTimeInterval timestamp;
+
+/*! Duration of the stall in seconds. Grows until the main queue starts responding again */
+@property (nonatomic, assign, readonly) NSTimeInterval duration;
+
+/*! Symbolicated main thread stack sampled when the stall has been detected */
+@property (nonatomic, copy, readonly) NSArray<NSString *> *stackSymbols;
+
+/*! JSON compatible representation of the stall */
+@property (nonatomic, copy, readonly) NSDictionary<NSString *, id> *dictionaryRepresentation;
+
+@end
+
+/**
+ Measures main queue responsiveness from a background queue by submitting heartbeat blocks to the main queue.
+ Main thread stack is sampled whenever a heartbeat waits longer than the stall threshold.
+ */
+@interface FBMainQueueWatchdog : NSObject
+
+/*! Interval between heartbeats in seconds. Defaults to 0.5 */
+@property (nonatomic, assign) NSTimeInterval heartbeatInterval;
+
+/*! Heartbeat delay in seconds, after which the main thread stack is sampled. Defaults to 1 */
+@property (nonatomic, assign) NSTimeInterval stallThreshold;
+
+/*! Delays between heartbeat submission and start in seconds */
+@property (nonatomic, strong, readonly) FBHistogram *lag;
+
+/*! The most recent heartbeat delay in seconds. Includes the delay of the heartbeat being currently waited for */
+@property (nonatomic, assign, readonly) NSTimeInterval currentLag;
+
+/*! Snapshots of the most recent stalls, the oldest first. The duration of an ongoing stall is not updated in the returned snapshot */
+@property (nonatomic, copy, readonly) NSArray<FBMainQueueStall *> *recentStalls;
+
+/*! The count of stalls detected since the watchdog has been started */
+@property (nonatomic, assign, readonly) NSUInteger stallsCount;
+
+/**
+ Returns the watchdog shared by the whole process
+ */
++ (instancetype)sharedWatchdog;
+
+/**
+ Starts sending heartbeats. Must be called on the main thread. Subsequent calls do nothing.
+ */
+- (void)start;
+
+/**
+ Stops sending heartbeats
+ */
+- (void)stop;
+
+/**
+ Renders lag histogram and stalls count in Prometheus text exposition format
+ */
+- (NSString *)prometheusText;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,313 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import "FBMainQueueWatchdog.h"
+
+#import <dlfcn.h>
+#import <mach/mach.h>
+#if __has_feature(ptrauth_calls)
+#import <ptrauth.h>
+#endif
+
+#import "FBHistogram.h"
+#import "FBLogger.h"
+
+static const NSTimeInterval FBDefaultHeartbeatInterval = 0.5;
+static const NSTimeInterval FBDefaultStallThreshold = 1.;
+static const NSUInteger FBMaxRecentStalls = 10;
+static const NSUInteger FBMaxStackFrames = 64;
+
+static NSArray<NSNumber *> *FBLagBuckets(void)
+{
+  return @[@0.001, @0.005, @0.01, @0.05, @0.1, @0.25, @0.5, @1, @2.5, @5, @10, @30];
+}
+
+static uintptr_t FBStripPointerAuthentication(uintptr_t address)
+{
+#if __has_feature(ptrauth_calls)
+  return (uintptr_t)ptrauth_strip((void *)address, ptrauth_key_return_address);
+#else
+  return address;
+#endif
+}
+
+/**
+ Collects return addresses of the suspended thread by walking its frame pointers.
+ Nothing is allocated here, since the suspended thread might hold the allocator lock.
+ */
+static NSUInteger FBCollectFrameAddresses(thread_t thread, uintptr_t *addresses, NSUInteger maxCount)
+{
+  NSUInteger count = 0;
+  uintptr_t framePointer = 0;
+#if defined(__arm64__)
+  arm_thread_state64_t state;
+  mach_msg_type_number_t stateCount = ARM_THREAD_STATE64_COUNT;
+  if (KERN_SUCCESS != thread_get_state(thread, ARM_THREAD_STATE64, (thread_state_t)&state, &stateCount)) {
+    return 0;
+  }
+#ifdef arm_thread_state64_get_pc
+  addresses[count++] = FBStripPointerAuthentication((uintptr_t)arm_thread_state64_get_pc(state));
+  addresses[count++] = FBStripPointerAuthentication((uintptr_t)arm_thread_state64_get_lr(state));
+  framePointer = (uintptr_t)arm_thread_state64_get_fp(state);
+#else
+  addresses[count++] = (uintptr_t)state.__pc;
+  addresses[count++] = (uintptr_t)state.__lr;
+  framePointer = (uintptr_t)state.__fp;
+#endif
+#elif defined(__x86_64__)
+  x86_thread_state64_t state;
+  mach_msg_type_number_t stateCount = x86_THREAD_STATE64_COUNT;
+  if (KERN_SUCCESS != thread_get_state(thread, x86_THREAD_STATE64, (thread_state_t)&state, &stateCount)) {
+    return 0;
+  }
+  addresses[count++] = (uintptr_t)state.__rip;
+  framePointer = (uintptr_t)state.__rbp;
+#else
+  return 0;
+#endif
+  while (framePointer && count < maxCount) {
+    // Each frame starts with the pointer to the previous frame followed by the return address
+    uintptr_t frame[2];
+    vm_size_t readSize = 0;
+    if (KERN_SUCCESS != vm_read_overwrite(mach_task_self(), (vm_address_t)framePointer, sizeof(frame), (vm_address_t)frame, &readSize)
+        || readSize != sizeof(frame)) {
+      break;
+    }
+    if (0 == frame[1]) {
+      break;
+    }
+    addresses[count++] = FBStripPointerAuthentication(frame[1]);
+    // Stacks grow down, so previous frames are always located at higher addresses
+    if (frame[0] <= framePointer) {
+      break;
+    }
+    framePointer = frame[0];
+  }
+  return count;
+}
+
+static NSArray<NSString *> *FBStackSymbolsOfThread(thread_t thread)
+{
+  uintptr_t addresses[FBMaxStackFrames];
+  if (KERN_SUCCESS != thread_suspend(thread)) {
+    return @[];
+  }
+  NSUInteger count = FBCollectFrameAddresses(thread, addresses, FBMaxStackFrames);
+  thread_resume(thread);
+
+  NSMutableArray<NSString *> *symbols = [NSMutableArray arrayWithCapacity:count];
+  for (NSUInteger index = 0; index < count; index++) {
+    Dl_info info;
+    if (dladdr((void *)addresses[index], &info) && info.dli_sname) {
+      const char *imageName = info.dli_fname ? strrchr(info.dli_fname, '/') : NULL;
+      [symbols addObject:[NSString stringWithFormat:@"%-4lu %-32s 0x%016lx %s + %lu",
+                          (unsigned long)index,
+                          imageName ? imageName + 1 : "???",
+                          (unsigned long)addresses[index],
+                          info.dli_sname,
+                          (unsigned long)(addresses[index] - (uintptr_t)info.dli_saddr)]];
+    } else {
+      [symbols addObject:[NSString stringWithFormat:@"%-4lu %-32s 0x%016lx", (unsigned long)index, "???", (unsigned long)addresses[index]]];
+    }
+  }
+  return symbols.copy;
+}
+
+@interface FBMainQueueStall ()
+@property (nonatomic, assign, readwrite) NSTimeInterval timestamp;
+@property (nonatomic, assign, readwrite) NSTimeInterval duration;
+@property (nonatomic, copy, readwrite) NSArray<NSString *> *stackSymbols;
+@end
+
+@implementation FBMainQueueStall
+
+- (id)copyWithZone:(NSZone *)zone
+{
+  FBMainQueueStall *stall = [[self.class allocWithZone:zone] init];
+  stall.timestamp = self.timestamp;
+  stall.duration = self.duration;
+  stall.stackSymbols = self.stackSymbols;
+  return stall;
+}
+
+- (NSDictionary<NSString *, id> *)dictionaryRepresentation
+{
+  return @{
+    @"timestamp" : @(self.timestamp),
+    @"duration" : @(self.duration),
+    @"stack" : self.stackSymbols,
+  };
+}
+
+@end
+
+@interface FBMainQueueWatchdog ()
+@property (nonatomic, strong) dispatch_queue_t queue;
+@property (nonatomic, strong, nullable) dispatch_source_t timer;
+@property (nonatomic, assign) thread_t mainThread;
+@property (nonatomic, strong, readwrite) FBHistogram *lag;
+@property (nonatomic, assign) NSTimeInterval lastLag;
+// Submission time of the heartbeat, which has not been started yet, or zero
+@property (nonatomic, assign) NSTimeInterval pendingHeartbeatTime;
+@property (nonatomic, strong, nullable) FBMainQueueStall *ongoingStall;
+@property (nonatomic, strong) NSMutableArray<FBMainQueueStall *> *stalls;
+@property (nonatomic, assign) NSUInteger detectedStallsCount;
+@end
+
+@implementation FBMainQueueWatchdog
+
++ (instancetype)sharedWatchdog
+{
+  static FBMainQueueWatchdog *watchdog;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    watchdog = [FBMainQueueWatchdog new];
+  });
+  return watchdog;
+}
+
+- (instancetype)init
+{
+  self = [super init];
+  if (self) {
+    _queue = dispatch_queue_create("com.facebook.wda.mainQueueWatchdog", DISPATCH_QUEUE_SERIAL);
+    _heartbeatInterval = FBDefaultHeartbeatInterval;
+    _stallThreshold = FBDefaultStallThreshold;
+    _lag = [[FBHistogram alloc] initWithBucketBounds:FBLagBuckets()];
+    _stalls = [NSMutableArray array];
+  }
+  return self;
+}
+
+- (void)start
+{
+  NSAssert([NSThread isMainThread], @"The watchdog must be started on the main thread", nil);
+  thread_t mainThread = mach_thread_self();
+  dispatch_sync(self.queue, ^{
+    if (self.timer) {
+      mach_port_deallocate(mach_task_self(), mainThread);
+      return;
+    }
+    self.mainThread = mainThread;
+    self.timer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, self.queue);
+    uint64_t interval = (uint64_t)(self.heartbeatInterval * NSEC_PER_SEC);
+    dispatch_source_set_timer(self.timer, dispatch_time(DISPATCH_TIME_NOW, (int64_t)interval), interval, interval / 10);
+    __weak FBMainQueueWatchdog *weakSelf = self;
+    dispatch_source_set_event_handler(self.timer, ^{
+      [weakSelf tick];
+    });
+    dispatch_resume(self.timer);
+  });
+}
+
+- (void)stop
+{
+  dispatch_sync(self.queue, ^{
+    if (!self.timer) {
+      return;
+    }
+    dispatch_source_cancel(self.timer);
+    self.timer = nil;
+    mach_port_deallocate(mach_task_self(), self.mainThread);
+    self.mainThread = MACH_PORT_NULL;
+  });
+}
+
+- (void)tick
+{
+  NSTimeInterval now = [NSProcessInfo processInfo].systemUptime;
+  if (self.pendingHeartbeatTime > 0) {
+    NSTimeInterval waitTime = now - self.pendingHeartbeatTime;
+    if (self.ongoingStall) {
+      self.ongoingStall.duration = waitTime;
+    } else if (waitTime >= self.stallThreshold) {
+      [self recordStallWithDuration:waitTime];
+    }
+    return;
+  }
+  self.pendingHeartbeatTime = now;
+  dispatch_async(dispatch_get_main_queue(), ^{
+    NSTimeInterval startTime = [NSProcessInfo processInfo].systemUptime;
+    dispatch_async(self.queue, ^{
+      [self heartbeatSubmittedAt:now startedAt:startTime];
+    });
+  });
+}
+
+- (void)heartbeatSubmittedAt:(NSTimeInterval)submitTime startedAt:(NSTimeInterval)startTime
+{
+  NSTimeInterval lag = startTime - submitTime;
+  [self.lag recordValue:lag];
+  self.lastLag = lag;
+  self.pendingHeartbeatTime = 0;
+  if (self.ongoingStall) {
+    self.ongoingStall.duration = lag;
+    FBLogStructured(FBLogLevelWarning, @"Main queue stall finished", @{@"duration": @(lag)});
+    self.ongoingStall = nil;
+  }
+}
+
+- (void)recordStallWithDuration:(NSTimeInterval)duration
+{
+  FBMainQueueStall *stall = [FBMainQueueStall new];
+  stall.timestamp = [NSProcessInfo processInfo].systemUptime;
+  stall.duration = duration;
+  stall.stackSymbols = MACH_PORT_NULL == self.mainThread ? @[] : FBStackSymbolsOfThread(self.mainThread);
+  self.ongoingStall = stall;
+  self.detectedStallsCount++;
+  [self.stalls addObject:stall];
+  if (self.stalls.count > FBMaxRecentStalls) {
+    [self.stalls removeObjectAtIndex:0];
+  }
+  FBLogStructured(FBLogLevelWarning, @"Main queue stall detected", (@{
+    @"duration": @(duration),
+    @"stack": [stall.stackSymbols componentsJoinedByString:@"\n"],
+  }));
+}
+
+- (NSTimeInterval)currentLag
+{
+  __block NSTimeInterval lag;
+  dispatch_sync(self.queue, ^{
+    lag = self.pendingHeartbeatTime > 0
+      ? MAX(self.lastLag, [NSProcessInfo processInfo].systemUptime - self.pendingHeartbeatTime)
+      : self.lastLag;
+  });
+  return lag;
+}
+
+- (NSArray<FBMainQueueStall *> *)recentStalls
+{
+  __block NSArray<FBMainQueueStall *> *stalls;
+  dispatch_sync(self.queue, ^{
+    // The ongoing stall is updated on the queue, so it must not be shared with other threads
+    stalls = [[NSArray alloc] initWithArray:self.stalls copyItems:YES];
+  });
+  return stalls;
+}
+
+- (NSUInteger)stallsCount
+{
+  __block NSUInteger count;
+  dispatch_sync(self.queue, ^{
+    count = self.detectedStallsCount;
+  });
+  return count;
+}
+
+- (NSString *)prometheusText
+{
+  NSMutableString *text = [NSMutableString string];
+  [text appendString:@"# HELP wda_main_queue_lag_seconds Delay between submitting a block to the main queue and its start\n# TYPE wda_main_queue_lag_seconds histogram\n"];
+  [text appendString:[self.lag prometheusSamplesWithName:@"wda_main_queue_lag_seconds" labels:nil]];
+  [text appendFormat:@"# HELP wda_main_queue_stalls_total Count of main queue stalls\n# TYPE wda_main_queue_stalls_total counter\nwda_main_queue_stalls_total %lu\n", (unsigned long)self.stallsCount];
+  return text.copy;
+}
+
+@end
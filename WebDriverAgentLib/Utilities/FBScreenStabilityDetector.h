@@ -0,0 +1,67 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Returns encoded image of the current screen state or nil if it cannot be captured
+ */
+typedef NSData *_Nullable (^FBScreenStabilityFrameSource)(void);
+
+/**
+ Samples screen frames and detects the moment when the screen stops changing.
+ Frames are downscaled and compared by tile hashes, so small rendering differences
+ inside a single tile do not require pixel by pixel comparison.
+ */
+@interface FBScreenStabilityDetector : NSObject
+
+/*! The count of consecutive matching frames, which makes the screen stable. 3 by default */
+@property (nonatomic, assign) NSUInteger stableFramesCount;
+
+/*! The minimum interval between two frames in seconds. 0.1 by default */
+@property (nonatomic, assign) NSTimeInterval samplingInterval;
+
+/*! The maximum count of changed tiles, which still makes frames match. 0 by default */
+@property (nonatomic, assign) NSUInteger changedTilesTolerance;
+
+/*! The count of frames sampled during the last wait */
+@property (nonatomic, assign, readonly) NSUInteger sampledFramesCount;
+
+/*! The count of changed tiles between the two most recent frames of the last wait */
+@property (nonatomic, assign, readonly) NSUInteger lastChangedTilesCount;
+
+/**
+ Creates the detector
+
+ @param frameSource the block used to capture frames. It is called on the thread, which waits for stability
+ */
+- (instancetype)initWithFrameSource:(FBScreenStabilityFrameSource)frameSource;
+
+/**
+ Blocks the calling thread until the screen is stable or the timeout expires
+
+ @param timeout the maximum amount of seconds to wait
+ @param error If there is an error, upon return contains an NSError object that describes the problem.
+ @return YES if the screen is stable, otherwise NO
+ */
+- (BOOL)waitUntilStableWithTimeout:(NSTimeInterval)timeout error:(NSError **)error;
+
+/**
+ Returns tile hashes of the given encoded image
+
+ @param imageData the encoded image
+ @return the data containing uint64_t hash per tile or nil if the image cannot be decoded
+ */
+- (nullable NSData *)tileHashesOfImageData:(NSData *)imageData;
+
+@end
+
+NS_ASSUME_NONNULL_END
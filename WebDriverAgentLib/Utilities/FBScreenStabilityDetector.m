@@ -0,0 +1,109 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import "FBScreenStabilityDetector.h"
+
+#import <ImageIO/ImageIO.h>
+#import <UIKit/UIKit.h>
+
+#import "FBErrorBuilder.h"
+#import "FBTileHasher.h"
+
+/*! Frames are downscaled to this size before hashing, since only coarse changes matter */
+static const NSUInteger FBStabilityFrameMaxDimension = 320;
+static const size_t FBStabilityTileSize = 16;
+
+@interface FBScreenStabilityDetector ()
+@property (nonatomic, copy, readonly) FBScreenStabilityFrameSource frameSource;
+@property (nonatomic, assign, readwrite) NSUInteger sampledFramesCount;
+@property (nonatomic, assign, readwrite) NSUInteger lastChangedTilesCount;
+@end
+
+@implementation FBScreenStabilityDetector
+
+- (instancetype)initWithFrameSource:(FBScreenStabilityFrameSource)frameSource
+{
+  self = [super init];
+  if (self) {
+    _frameSource = [frameSource copy];
+    _stableFramesCount = 3;
+    _samplingInterval = 0.1;
+    _changedTilesTolerance = 0;
+  }
+  return self;
+}
+
+- (BOOL)waitUntilStableWithTimeout:(NSTimeInterval)timeout error:(NSError **)error
+{
+  self.sampledFramesCount = 0;
+  self.lastChangedTilesCount = 0;
+  NSTimeInterval deadline = [NSProcessInfo processInfo].systemUptime + timeout;
+  NSData *previousHashes = nil;
+  NSUInteger matchingFramesCount = 0;
+  while (YES) {
+    NSTimeInterval frameStart = [NSProcessInfo processInfo].systemUptime;
+    NSData *imageData = self.frameSource();
+    NSData *hashes = nil == imageData ? nil : [self tileHashesOfImageData:imageData];
+    if (nil != hashes) {
+      self.sampledFramesCount++;
+      if (nil != previousHashes && previousHashes.length == hashes.length) {
+        self.lastChangedTilesCount = FBChangedTilesCount(hashes.bytes, previousHashes.bytes, hashes.length / sizeof(uint64_t));
+        matchingFramesCount = self.lastChangedTilesCount <= self.changedTilesTolerance ? matchingFramesCount + 1 : 1;
+      } else {
+        matchingFramesCount = 1;
+      }
+      previousHashes = hashes;
+      if (matchingFramesCount >= MAX(self.stableFramesCount, 1)) {
+        return YES;
+      }
+    }
+    NSTimeInterval now = [NSProcessInfo processInfo].systemUptime;
+    NSTimeInterval delay = MAX(0, self.samplingInterval - (now - frameStart));
+    if (now + delay >= deadline) {
+      break;
+    }
+    [NSThread sleepForTimeInterval:delay];
+  }
+  return [[[FBErrorBuilder builder]
+           withDescriptionFormat:@"The screen has not become stable within %.2f seconds timeout. %lu frames sampled, %lu tiles changed in the last one", timeout, (unsigned long)self.sampledFramesCount, (unsigned long)self.lastChangedTilesCount]
+          buildError:error];
+}
+
+- (NSData *)tileHashesOfImageData:(NSData *)imageData
+{
+  CGImageSourceRef imageSource = CGImageSourceCreateWithData((__bridge CFDataRef)imageData, NULL);
+  if (NULL == imageSource) {
+    return nil;
+  }
+  NSDictionary *thumbnailOptions = @{
+    (__bridge NSString *)kCGImageSourceCreateThumbnailFromImageAlways: @YES,
+    (__bridge NSString *)kCGImageSourceThumbnailMaxPixelSize: @(FBStabilityFrameMaxDimension),
+  };
+  CGImageRef image = CGImageSourceCreateThumbnailAtIndex(imageSource, 0, (__bridge CFDictionaryRef)thumbnailOptions);
+  CFRelease(imageSource);
+  if (NULL == image) {
+    return nil;
+  }
+  size_t width = CGImageGetWidth(image);
+  size_t height = CGImageGetHeight(image);
+  size_t bytesPerRow = width * sizeof(uint32_t);
+  NSMutableData *pixels = [NSMutableData dataWithLength:bytesPerRow * height];
+  CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB();
+  CGContextRef context = CGBitmapContextCreate(pixels.mutableBytes, width, height, 8, bytesPerRow, colorSpace, kCGImageAlphaPremultipliedLast);
+  CGColorSpaceRelease(colorSpace);
+  CGContextDrawImage(context, CGRectMake(0, 0, width, height), image);
+  CGContextRelease(context);
+  CGImageRelease(image);
+
+  NSMutableData *hashes = [NSMutableData dataWithLength:FBTilesCount(width, height, FBStabilityTileSize) * sizeof(uint64_t)];
+  FBComputeTileHashes(pixels.bytes, width, height, bytesPerRow, FBStabilityTileSize, hashes.mutableBytes);
+  return hashes.copy;
+}
+
+@end
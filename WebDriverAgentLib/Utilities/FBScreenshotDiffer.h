@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Changed region of the screenshot
+ */
+@interface FBScreenshotTile : NSObject
+
+/*! Region of the screenshot in pixels. The origin is in the top left corner */
+@property (nonatomic, assign, readonly) CGRect rect;
+
+/*! Encoded image of the region */
+@property (nonatomic, copy, readonly) NSData *imageData;
+
+@end
+
+/**
+ Difference between two subsequent screenshots
+ */
+@interface FBScreenshotDelta : NSObject
+
+/*! Sequence number of the screenshot */
+@property (nonatomic, assign, readonly) NSUInteger sequenceNumber;
+
+/*! Sequence number of the screenshot the tiles should be applied to or zero if the tiles cover the whole screenshot */
+@property (nonatomic, assign, readonly) NSUInteger baseSequenceNumber;
+
+/*! Size of the screenshot in pixels */
+@property (nonatomic, assign, readonly) CGSize size;
+
+/*! Changed regions of the screenshot */
+@property (nonatomic, copy, readonly) NSArray<FBScreenshotTile *> *tiles;
+
+@end
+
+/**
+ Keeps the previous screenshot and calculates which parts of the next one have changed.
+ Screenshots are split into square tiles, which are compared row by row.
+ Adjacent changed tiles are merged into rectangles.
+ */
+@interface FBScreenshotDiffer : NSObject
+
+/*! Side of a single tile in pixels */
+@property (nonatomic, assign, readonly) NSUInteger tileSize;
+
+/*! Sequence number of the most recent screenshot or zero if there was no screenshot yet */
+@property (nonatomic, assign, readonly) NSUInteger sequenceNumber;
+
+/**
+ Creates the differ
+
+ @param tileSize side of a single tile in pixels
+ */
+- (instancetype)initWithTileSize:(NSUInteger)tileSize;
+
+/**
+ Calculates the difference between the given screenshot and the previous one and remembers
+ the given screenshot as the previous one.
+ If the base sequence number does not match the previous screenshot, then the whole screenshot is returned as a single tile.
+
+ @param imageData the encoded screenshot
+ @param baseSequenceNumber the sequence number of the screenshot the client currently has or zero
+ @param mimeType the format of tile images. Either FBImageMimeTypePNG or FBImageMimeTypeJPEG
+ @param compressionQuality JPEG compression quality of tile images in range (0, 1]
+ @param error If there is an error, upon return contains an NSError object that describes the problem.
+ @return the screenshot delta or nil in case of failure
+ */
+- (nullable FBScreenshotDelta *)deltaWithImageData:(NSData *)imageData baseSequenceNumber:(NSUInteger)baseSequenceNumber mimeType:(NSString *)mimeType compressionQuality:(CGFloat)compressionQuality error:(NSError **)error;
+
+/**
+ Returns rectangles, which cover all the changed tiles of two RGBA bitmaps of the same size
+
+ @param pixels the current bitmap
+ @param previousPixels the previous bitmap
+ @param width bitmap width in pixels
+ @param height bitmap height in pixels
+ @param tileSize side of a single tile in pixels
+ @return array of CGRect values in pixels
+ */
++ (NSArray<NSValue *> *)dirtyRectsBetweenPixels:(NSData *)pixels previousPixels:(NSData *)previousPixels width:(size_t)width height:(size_t)height tileSize:(NSUInteger)tileSize;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,175 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import "FBScreenshotDiffer.h"
+
+#import <ImageIO/ImageIO.h>
+
+#import "FBErrorBuilder.h"
+#import "FBImageUtils.h"
+
+static const size_t FBBytesPerPixel = 4;
+
+@interface FBScreenshotTile ()
+@property (nonatomic, assign, readwrite) CGRect rect;
+@property (nonatomic, copy, readwrite) NSData *imageData;
+@end
+
+@implementation FBScreenshotTile
+@end
+
+@interface FBScreenshotDelta ()
+@property (nonatomic, assign, readwrite) NSUInteger sequenceNumber;
+@property (nonatomic, assign, readwrite) NSUInteger baseSequenceNumber;
+@property (nonatomic, assign, readwrite) CGSize size;
+@property (nonatomic, copy, readwrite) NSArray<FBScreenshotTile *> *tiles;
+@end
+
+@implementation FBScreenshotDelta
+@end
+
+@interface FBScreenshotDiffer ()
+@property (nonatomic, assign, readwrite) NSUInteger sequenceNumber;
+@property (nonatomic, strong, nullable) NSData *previousPixels;
+@property (nonatomic, assign) size_t previousWidth;
+@property (nonatomic, assign) size_t previousHeight;
+@end
+
+@implementation FBScreenshotDiffer
+
+- (instancetype)initWithTileSize:(NSUInteger)tileSize
+{
+  NSParameterAssert(tileSize > 0);
+  self = [super init];
+  if (self) {
+    _tileSize = MAX(tileSize, 1);
+  }
+  return self;
+}
+
+- (FBScreenshotDelta *)deltaWithImageData:(NSData *)imageData baseSequenceNumber:(NSUInteger)baseSequenceNumber mimeType:(NSString *)mimeType compressionQuality:(CGFloat)compressionQuality error:(NSError **)error
+{
+  CGImageSourceRef imageSource = CGImageSourceCreateWithData((__bridge CFDataRef)imageData, NULL);
+  CGImageRef image = NULL == imageSource ? NULL : CGImageSourceCreateImageAtIndex(imageSource, 0, NULL);
+  if (NULL != imageSource) {
+    CFRelease(imageSource);
+  }
+  if (NULL == image) {
+    [[[FBErrorBuilder builder] withDescription:@"Cannot decode the screenshot"] buildError:error];
+    return nil;
+  }
+
+  size_t width = CGImageGetWidth(image);
+  size_t height = CGImageGetHeight(image);
+  NSMutableData *pixels = [NSMutableData dataWithLength:width * height * FBBytesPerPixel];
+  CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB();
+  CGContextRef context = CGBitmapContextCreate(pixels.mutableBytes, width, height, 8, width * FBBytesPerPixel, colorSpace, kCGImageAlphaPremultipliedLast);
+  CGColorSpaceRelease(colorSpace);
+  CGContextDrawImage(context, CGRectMake(0, 0, width, height), image);
+  CGImageRelease(image);
+  CGImageRef bitmapImage = CGBitmapContextCreateImage(context);
+  CGContextRelease(context);
+
+  BOOL isIncremental = baseSequenceNumber > 0
+    && baseSequenceNumber == self.sequenceNumber
+    && nil != self.previousPixels
+    && width == self.previousWidth
+    && height == self.previousHeight;
+  NSArray<NSValue *> *dirtyRects = isIncremental
+    ? [self.class dirtyRectsBetweenPixels:pixels previousPixels:(NSData *)self.previousPixels width:width height:height tileSize:self.tileSize]
+    : @[[NSValue valueWithCGRect:CGRectMake(0, 0, width, height)]];
+
+  NSMutableArray<FBScreenshotTile *> *tiles = [NSMutableArray array];
+  for (NSValue *dirtyRect in dirtyRects) {
+    CGImageRef tileImage = CGImageCreateWithImageInRect(bitmapImage, dirtyRect.CGRectValue);
+    NSData *tileData = NULL == tileImage ? nil : FBEncodedImageData(tileImage, mimeType, compressionQuality);
+    CGImageRelease(tileImage);
+    if (nil == tileData) {
+      CGImageRelease(bitmapImage);
+      [[[FBErrorBuilder builder] withDescriptionFormat:@"Cannot encode the screenshot region %@", NSStringFromCGRect(dirtyRect.CGRectValue)] buildError:error];
+      return nil;
+    }
+    FBScreenshotTile *tile = [FBScreenshotTile new];
+    tile.rect = dirtyRect.CGRectValue;
+    tile.imageData = tileData;
+    [tiles addObject:tile];
+  }
+  CGImageRelease(bitmapImage);
+
+  self.previousPixels = pixels;
+  self.previousWidth = width;
+  self.previousHeight = height;
+  self.sequenceNumber++;
+
+  FBScreenshotDelta *delta = [FBScreenshotDelta new];
+  delta.sequenceNumber = self.sequenceNumber;
+  delta.baseSequenceNumber = isIncremental ? baseSequenceNumber : 0;
+  delta.size = CGSizeMake(width, height);
+  delta.tiles = tiles.copy;
+  return delta;
+}
+
++ (NSArray<NSValue *> *)dirtyRectsBetweenPixels:(NSData *)pixels previousPixels:(NSData *)previousPixels width:(size_t)width height:(size_t)height tileSize:(NSUInteger)tileSize
+{
+  const uint8_t *bytes = pixels.bytes;
+  const uint8_t *previousBytes = previousPixels.bytes;
+  size_t bytesPerRow = width * FBBytesPerPixel;
+  size_t columnsCount = (width + tileSize - 1) / tileSize;
+  size_t rowsCount = (height + tileSize - 1) / tileSize;
+
+  NSMutableArray<NSValue *> *dirtyRects = [NSMutableArray array];
+  // Rectangles, which are still growing downwards, keyed by their first and last tile columns
+  NSMutableDictionary<NSValue *, NSValue *> *openRects = [NSMutableDictionary dictionary];
+  for (size_t row = 0; row < rowsCount; row++) {
+    size_t top = row * tileSize;
+    size_t tileHeight = MIN(tileSize, height - top);
+    NSMutableDictionary<NSValue *, NSValue *> *nextOpenRects = [NSMutableDictionary dictionary];
+    size_t column = 0;
+    while (column < columnsCount) {
+      size_t runStart = column;
+      while (column < columnsCount) {
+        size_t left = column * tileSize;
+        size_t tileBytesCount = MIN(tileSize, width - left) * FBBytesPerPixel;
+        BOOL isDirty = NO;
+        for (size_t y = top; y < top + tileHeight && !isDirty; y++) {
+          size_t offset = y * bytesPerRow + left * FBBytesPerPixel;
+          isDirty = 0 != memcmp(bytes + offset, previousBytes + offset, tileBytesCount);
+        }
+        if (!isDirty) {
+          break;
+        }
+        column++;
+      }
+      if (column > runStart) {
+        NSValue *span = [NSValue valueWithRange:NSMakeRange(runStart, column - runStart)];
+        CGRect rect = CGRectMake(runStart * tileSize, top, MIN((column - runStart) * tileSize, width - runStart * tileSize), tileHeight);
+        NSValue *openRect = openRects[span];
+        if (nil != openRect) {
+          rect = CGRectUnion(openRect.CGRectValue, rect);
+          [openRects removeObjectForKey:span];
+        }
+        nextOpenRects[span] = [NSValue valueWithCGRect:rect];
+      }
+      column++;
+    }
+    [dirtyRects addObjectsFromArray:openRects.allValues];
+    openRects = nextOpenRects;
+  }
+  [dirtyRects addObjectsFromArray:openRects.allValues];
+  return [dirtyRects sortedArrayUsingComparator:^NSComparisonResult(NSValue *first, NSValue *second) {
+    CGRect firstRect = first.CGRectValue;
+    CGRect secondRect = second.CGRectValue;
+    if (CGRectGetMinY(firstRect) != CGRectGetMinY(secondRect)) {
+      return CGRectGetMinY(firstRect) < CGRectGetMinY(secondRect) ? NSOrderedAscending : NSOrderedDescending;
+    }
+    return CGRectGetMinX(firstRect) < CGRectGetMinX(secondRect) ? NSOrderedAscending : NSOrderedDescending;
+  }];
+}
+
+@end
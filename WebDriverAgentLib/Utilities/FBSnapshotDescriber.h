@@ -0,0 +1,34 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <Foundation/Foundation.h>
+
+@class XCElementSnapshot;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Renders human readable description of element snapshot trees,
+ similar to the one XCTest prints for debugDescription of elements
+ */
+@interface FBSnapshotDescriber : NSObject
+
+/**
+ Describes the snapshot and its descendants in a single pass over the already taken snapshot.
+ Each element is described on a separate line, indented according to its depth.
+
+ @param snapshot the root of the described tree
+ @param maxDepth the maximum depth of described descendants. 0 describes the root only
+ @return tree description
+ */
++ (NSString *)descriptionOfSnapshot:(XCElementSnapshot *)snapshot maxDepth:(NSUInteger)maxDepth;
+
+@end
+
+NS_ASSUME_NONNULL_END
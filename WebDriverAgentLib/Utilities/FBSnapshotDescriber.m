@@ -0,0 +1,67 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import "FBSnapshotDescriber.h"
+
+#import "FBElementTypeTransformer.h"
+#import "XCElementSnapshot.h"
+#import "XCUIElement+FBWebDriverAttributes.h"
+
+static NSString *const FBDescriptionIndent = @"  ";
+
+@implementation FBSnapshotDescriber
+
++ (NSString *)descriptionOfSnapshot:(XCElementSnapshot *)snapshot maxDepth:(NSUInteger)maxDepth
+{
+  NSMutableString *description = [NSMutableString string];
+  [self appendDescriptionOfSnapshot:snapshot depth:0 maxDepth:maxDepth toString:description];
+  return description.copy;
+}
+
++ (void)appendDescriptionOfSnapshot:(XCElementSnapshot *)snapshot depth:(NSUInteger)depth maxDepth:(NSUInteger)maxDepth toString:(NSMutableString *)description
+{
+  if (description.length > 0) {
+    [description appendString:@"\n"];
+  }
+  for (NSUInteger level = 0; level < depth; level++) {
+    [description appendString:FBDescriptionIndent];
+  }
+  [description appendString:[FBElementTypeTransformer shortStringWithElementType:snapshot.elementType]];
+  CGRect frame = snapshot.wdFrame;
+  [description appendFormat:@", {{%.1f, %.1f}, {%.1f, %.1f}}", frame.origin.x, frame.origin.y, frame.size.width, frame.size.height];
+  [self appendAttribute:@"name" value:snapshot.wdName toString:description];
+  [self appendAttribute:@"label" value:snapshot.wdLabel toString:description];
+  [self appendAttribute:@"value" value:snapshot.wdValue toString:description];
+  if (!snapshot.isWDEnabled) {
+    [description appendString:@", Disabled"];
+  }
+
+  if (depth >= maxDepth) {
+    if (snapshot.children.count > 0) {
+      [description appendFormat:@", %lu children not shown", (unsigned long)snapshot.children.count];
+    }
+    return;
+  }
+  for (XCElementSnapshot *child in snapshot.children) {
+    [self appendDescriptionOfSnapshot:child depth:depth + 1 maxDepth:maxDepth toString:description];
+  }
+}
+
++ (void)appendAttribute:(NSString *)attribute value:(nullable id)value toString:(NSMutableString *)description
+{
+  NSString *stringValue = [value isKindOfClass:NSString.class] ? value : [value description];
+  if (0 == stringValue.length) {
+    return;
+  }
+  // Multiline values would break the tree layout
+  stringValue = [[stringValue componentsSeparatedByCharactersInSet:[NSCharacterSet newlineCharacterSet]] componentsJoinedByString:@"\\n"];
+  [description appendFormat:@", %@: '%@'", attribute, stringValue];
+}
+
+@end
@@ -0,0 +1,53 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Keeps the most recent revisions of the JSON source tree and calculates
+ the changes between them, so clients can refresh large trees incrementally.
+ Nodes are identified by their index paths.
+ */
+@interface FBSourceRevisionStore : NSObject
+
+/**
+ Creates the store
+
+ @param capacity the count of the most recent revisions to keep
+ */
+- (instancetype)initWithCapacity:(NSUInteger)capacity;
+
+/**
+ Stores the tree as the new revision and returns the changes since the given revision.
+ The result contains 'revision' identifier of the given tree and 'base' revision.
+ If the base revision is known, then 'patches' array contains the changed subtrees, each having
+ 'path' array of child indexes starting at the root and the replacement 'node'.
+ Otherwise the result contains the full 'tree' and the base is null.
+
+ @param tree the current tree
+ @param revision the revision the client has or nil
+ @return the changes description
+ */
+- (NSDictionary<NSString *, id> *)changesOfTree:(NSDictionary<NSString *, id> *)tree sinceRevision:(nullable NSString *)revision;
+
+/**
+ Returns the list of patches, which transform the old tree into the new one.
+ A subtree is replaced as a whole if its own attributes or its children count have changed.
+
+ @param oldTree the previous tree
+ @param newTree the current tree
+ @return array of patches as described in changesOfTree:sinceRevision:
+ */
++ (NSArray<NSDictionary<NSString *, id> *> *)patchesFromTree:(NSDictionary<NSString *, id> *)oldTree toTree:(NSDictionary<NSString *, id> *)newTree;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import "FBSourceRevisionStore.h"
+
+static NSString *const FBSourceChildrenKey = @"children";
+
+@interface FBSourceRevisionStore ()
+@property (nonatomic, assign, readonly) NSUInteger capacity;
+@property (nonatomic, strong, readonly) NSMutableArray<NSString *> *revisions;
+@property (nonatomic, strong, readonly) NSMutableDictionary<NSString *, NSDictionary *> *trees;
+@property (nonatomic, assign) NSUInteger lastRevisionNumber;
+@end
+
+@implementation FBSourceRevisionStore
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity
+{
+  self = [super init];
+  if (self) {
+    _capacity = MAX(capacity, 1);
+    _revisions = [NSMutableArray array];
+    _trees = [NSMutableDictionary dictionary];
+  }
+  return self;
+}
+
+- (NSDictionary<NSString *, id> *)changesOfTree:(NSDictionary<NSString *, id> *)tree sinceRevision:(NSString *)revision
+{
+  @synchronized (self) {
+    NSDictionary *baseTree = nil == revision ? nil : self.trees[(NSString *)revision];
+    if (nil == baseTree) {
+      return @{
+        @"revision": [self storeTree:tree],
+        @"base": [NSNull null],
+        @"tree": tree,
+      };
+    }
+    NSArray *patches = [self.class patchesFromTree:baseTree toTree:tree];
+    return @{
+      // Identical trees keep the revision, so the client does not need to remember a new one
+      @"revision": 0 == patches.count ? (NSString *)revision : [self storeTree:tree],
+      @"base": (NSString *)revision,
+      @"patches": patches,
+    };
+  }
+}
+
+- (NSString *)storeTree:(NSDictionary *)tree
+{
+  NSString *revision = [NSString stringWithFormat:@"%lu", (unsigned long)++self.lastRevisionNumber];
+  self.trees[revision] = tree;
+  [self.revisions addObject:revision];
+  while (self.revisions.count > self.capacity) {
+    [self.trees removeObjectForKey:self.revisions.firstObject];
+    [self.revisions removeObjectAtIndex:0];
+  }
+  return revision;
+}
+
++ (NSArray<NSDictionary<NSString *, id> *> *)patchesFromTree:(NSDictionary<NSString *, id> *)oldTree toTree:(NSDictionary<NSString *, id> *)newTree
+{
+  NSMutableArray<NSDictionary *> *patches = [NSMutableArray array];
+  [self collectPatchesFromNode:oldTree toNode:newTree path:@[] patches:patches];
+  return patches.copy;
+}
+
++ (void)collectPatchesFromNode:(NSDictionary *)oldNode toNode:(NSDictionary *)newNode path:(NSArray<NSNumber *> *)path patches:(NSMutableArray<NSDictionary *> *)patches
+{
+  NSArray<NSDictionary *> *oldChildren = oldNode[FBSourceChildrenKey];
+  NSArray<NSDictionary *> *newChildren = newNode[FBSourceChildrenKey];
+  if (oldChildren.count != newChildren.count || ![self hasSameAttributes:oldNode asNode:newNode]) {
+    [patches addObject:@{
+      @"path": path,
+      @"node": newNode,
+    }];
+    return;
+  }
+  [newChildren enumerateObjectsUsingBlock:^(NSDictionary *newChild, NSUInteger index, BOOL *stop) {
+    [self collectPatchesFromNode:oldChildren[index] toNode:newChild path:[path arrayByAddingObject:@(index)] patches:patches];
+  }];
+}
+
++ (BOOL)hasSameAttributes:(NSDictionary *)node asNode:(NSDictionary *)otherNode
+{
+  NSUInteger attributesCount = node.count - (nil == node[FBSourceChildrenKey] ? 0 : 1);
+  NSUInteger otherAttributesCount = otherNode.count - (nil == otherNode[FBSourceChildrenKey] ? 0 : 1);
+  if (attributesCount != otherAttributesCount) {
+    return NO;
+  }
+  for (NSString *key in node) {
+    if ([key isEqualToString:FBSourceChildrenKey]) {
+      continue;
+    }
+    if (![node[key] isEqual:otherNode[key]]) {
+      return NO;
+    }
+  }
+  return YES;
+}
+
+@end
@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <UIKit/UIKit.h>
+
+@class XCElementSnapshot;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Location of a single Springboard icon
+ */
+@interface FBSpringboardIcon : NSObject
+
+/*! Accessibility identifier of the icon */
+@property (nonatomic, copy, readonly, nullable) NSString *identifier;
+
+/*! Accessibility label of the icon */
+@property (nonatomic, copy, readonly, nullable) NSString *label;
+
+/*! Frame of the icon in screen coordinates */
+@property (nonatomic, assign, readonly) CGRect frame;
+
+/*! Page of the icon relative to the visible page. Negative values mean pages on the left */
+@property (nonatomic, assign, readonly) NSInteger page;
+
++ (instancetype)iconWithIdentifier:(nullable NSString *)identifier label:(nullable NSString *)label frame:(CGRect)frame;
+
+@end
+
+/**
+ Index of Springboard icons built from a single snapshot,
+ so the page of an application icon is known without querying icons one by one
+ */
+@interface FBSpringboardIconIndex : NSObject
+
+/*! The count of indexed icons */
+@property (nonatomic, assign, readonly) NSUInteger count;
+
+/**
+ Builds the index from Springboard snapshot
+
+ @param springboardSnapshot snapshot of Springboard application including its descendants
+ @return the index
+ */
++ (instancetype)indexWithSnapshot:(XCElementSnapshot *)springboardSnapshot;
+
+/**
+ Builds the index from the given icons
+
+ @param icons the icons to index
+ @param pageWidth the width of a single Springboard page
+ */
+- (instancetype)initWithIcons:(NSArray<FBSpringboardIcon *> *)icons pageWidth:(CGFloat)pageWidth;
+
+/**
+ Returns the icon of the application.
+ Icons are matched by identifier first and by label then.
+ The most recently installed application is selected if there are multiple matches.
+
+ @param identifier the identifier or the label of the application icon
+ @return the icon or nil if there is no such icon
+ */
+- (nullable FBSpringboardIcon *)iconForApplicationWithIdentifier:(NSString *)identifier;
+
+@end
+
+NS_ASSUME_NONNULL_END
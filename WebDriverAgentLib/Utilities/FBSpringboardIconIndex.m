@@ -0,0 +1,87 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import "FBSpringboardIconIndex.h"
+
+#import "XCElementSnapshot.h"
+
+@interface FBSpringboardIcon ()
+@property (nonatomic, copy, readwrite) NSString *identifier;
+@property (nonatomic, copy, readwrite) NSString *label;
+@property (nonatomic, assign, readwrite) CGRect frame;
+@property (nonatomic, assign, readwrite) NSInteger page;
+@end
+
+@implementation FBSpringboardIcon
+
++ (instancetype)iconWithIdentifier:(NSString *)identifier label:(NSString *)label frame:(CGRect)frame
+{
+  FBSpringboardIcon *icon = [FBSpringboardIcon new];
+  icon.identifier = identifier;
+  icon.label = label;
+  icon.frame = frame;
+  return icon;
+}
+
+- (NSString *)description
+{
+  return [NSString stringWithFormat:@"%@ '%@' page %ld %@", self.identifier, self.label, (long)self.page, NSStringFromCGRect(self.frame)];
+}
+
+@end
+
+@interface FBSpringboardIconIndex ()
+@property (nonatomic, strong) NSDictionary<NSString *, FBSpringboardIcon *> *iconsByIdentifier;
+@property (nonatomic, strong) NSDictionary<NSString *, FBSpringboardIcon *> *iconsByLabel;
+@property (nonatomic, assign, readwrite) NSUInteger count;
+@end
+
+@implementation FBSpringboardIconIndex
+
++ (instancetype)indexWithSnapshot:(XCElementSnapshot *)springboardSnapshot
+{
+  NSArray<XCElementSnapshot *> *iconSnapshots = [springboardSnapshot descendantsByFilteringWithBlock:^BOOL(XCElementSnapshot *snapshot) {
+    return snapshot.elementType == XCUIElementTypeIcon;
+  }];
+  NSMutableArray<FBSpringboardIcon *> *icons = [NSMutableArray array];
+  for (XCElementSnapshot *iconSnapshot in iconSnapshots) {
+    [icons addObject:[FBSpringboardIcon iconWithIdentifier:iconSnapshot.identifier label:iconSnapshot.label frame:iconSnapshot.frame]];
+  }
+  return [[self alloc] initWithIcons:icons pageWidth:CGRectGetWidth(springboardSnapshot.frame)];
+}
+
+- (instancetype)initWithIcons:(NSArray<FBSpringboardIcon *> *)icons pageWidth:(CGFloat)pageWidth
+{
+  self = [super init];
+  if (self) {
+    NSMutableDictionary<NSString *, FBSpringboardIcon *> *iconsByIdentifier = [NSMutableDictionary dictionary];
+    NSMutableDictionary<NSString *, FBSpringboardIcon *> *iconsByLabel = [NSMutableDictionary dictionary];
+    // Icons are enumerated in the order of installation, so later matches take precedence
+    for (FBSpringboardIcon *icon in icons) {
+      icon.page = pageWidth > 0 ? (NSInteger)floor(CGRectGetMidX(icon.frame) / pageWidth) : 0;
+      if (icon.identifier.length > 0) {
+        iconsByIdentifier[icon.identifier] = icon;
+      }
+      if (icon.label.length > 0) {
+        iconsByLabel[icon.label] = icon;
+      }
+    }
+    _iconsByIdentifier = iconsByIdentifier.copy;
+    _iconsByLabel = iconsByLabel.copy;
+    _count = icons.count;
+  }
+  return self;
+}
+
+- (FBSpringboardIcon *)iconForApplicationWithIdentifier:(NSString *)identifier
+{
+  return self.iconsByIdentifier[identifier] ?: self.iconsByLabel[identifier];
+}
+
+@end
@@ -0,0 +1,33 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/*! Returns the count of square tiles, which cover the bitmap of the given size */
+size_t FBTilesCount(size_t width, size_t height, size_t tileSize);
+
+/**
+ Computes hash of each tile of 32-bit per pixel bitmap.
+ Pixels are mixed into eight independent 32-bit lanes, so the inner loop can be vectorized by the compiler.
+
+ @param pixels the bitmap with 4 bytes per pixel
+ @param width bitmap width in pixels
+ @param height bitmap height in pixels
+ @param bytesPerRow bitmap row length in bytes
+ @param tileSize side of a single tile in pixels
+ @param hashes the buffer for the result. Must have room for FBTilesCount values. Tiles are stored row by row
+ */
+void FBComputeTileHashes(const uint8_t *pixels, size_t width, size_t height, size_t bytesPerRow, size_t tileSize, uint64_t *hashes);
+
+/*! Returns the count of positions, where the given hash arrays differ */
+size_t FBChangedTilesCount(const uint64_t *hashes, const uint64_t *otherHashes, size_t count);
+
+NS_ASSUME_NONNULL_END
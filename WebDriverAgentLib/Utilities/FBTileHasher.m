@@ -0,0 +1,71 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import "FBTileHasher.h"
+
+#define FB_TILE_HASH_LANES 8
+
+static const uint32_t FBTileHashPrime = 0x01000193;
+static const uint64_t FBTileHashMixPrime = 0x9E3779B97F4A7C15ULL;
+
+size_t FBTilesCount(size_t width, size_t height, size_t tileSize)
+{
+  return ((width + tileSize - 1) / tileSize) * ((height + tileSize - 1) / tileSize);
+}
+
+static uint64_t FBTileHash(const uint8_t *tileOrigin, size_t tileWidth, size_t tileHeight, size_t bytesPerRow)
+{
+  uint32_t lanes[FB_TILE_HASH_LANES];
+  for (size_t lane = 0; lane < FB_TILE_HASH_LANES; lane++) {
+    lanes[lane] = 0x811C9DC5 + (uint32_t)lane;
+  }
+  size_t vectorizedWidth = tileWidth - tileWidth % FB_TILE_HASH_LANES;
+  for (size_t y = 0; y < tileHeight; y++) {
+    const uint8_t *row = tileOrigin + y * bytesPerRow;
+    for (size_t x = 0; x < vectorizedWidth; x += FB_TILE_HASH_LANES) {
+      uint32_t words[FB_TILE_HASH_LANES];
+      memcpy(words, row + x * sizeof(uint32_t), sizeof(words));
+      for (size_t lane = 0; lane < FB_TILE_HASH_LANES; lane++) {
+        lanes[lane] = (lanes[lane] ^ words[lane]) * FBTileHashPrime;
+      }
+    }
+    for (size_t x = vectorizedWidth; x < tileWidth; x++) {
+      uint32_t word;
+      memcpy(&word, row + x * sizeof(uint32_t), sizeof(word));
+      size_t lane = x % FB_TILE_HASH_LANES;
+      lanes[lane] = (lanes[lane] ^ word) * FBTileHashPrime;
+    }
+  }
+  uint64_t hash = 0;
+  for (size_t lane = 0; lane < FB_TILE_HASH_LANES; lane++) {
+    hash = (hash ^ lanes[lane]) * FBTileHashMixPrime;
+  }
+  return hash ^ (hash >> 29);
+}
+
+void FBComputeTileHashes(const uint8_t *pixels, size_t width, size_t height, size_t bytesPerRow, size_t tileSize, uint64_t *hashes)
+{
+  size_t index = 0;
+  for (size_t top = 0; top < height; top += tileSize) {
+    size_t tileHeight = MIN(tileSize, height - top);
+    for (size_t left = 0; left < width; left += tileSize) {
+      size_t tileWidth = MIN(tileSize, width - left);
+      hashes[index++] = FBTileHash(pixels + top * bytesPerRow + left * sizeof(uint32_t), tileWidth, tileHeight, bytesPerRow);
+    }
+  }
+}
+
+size_t FBChangedTilesCount(const uint64_t *hashes, const uint64_t *otherHashes, size_t count)
+{
+  size_t result = 0;
+  for (size_t index = 0; index < count; index++) {
+    result += hashes[index] != otherHashes[index];
+  }
+  return result;
+}
@@ -0,0 +1,59 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Records the beginning of a span on the current thread.
+ 'name' must stay valid forever, so it should be either a string literal or a result of FBTraceInternName.
+ */
+void FBTraceBegin(const char *name);
+
+/**
+ Records the end of the most recent span with the same name on the current thread
+ */
+void FBTraceEnd(const char *name);
+
+/**
+ Returns the C string, which stays valid forever and can be used as span name
+ */
+const char *FBTraceInternName(NSString *name);
+
+/**
+ Associates all spans recorded on the current thread with the given request identifier.
+ Zero value means that there is no active request.
+ */
+void FBTraceSetCurrentRequestID(uint64_t requestID);
+
+/**
+ Returns new unique request identifier
+ */
+uint64_t FBTraceNextRequestID(void);
+
+/**
+ Ring buffer of the most recent tracing events
+ */
+@interface FBTrace : NSObject
+
+/**
+ Returns the recorded events in Chrome trace event format, which can be loaded
+ into chrome://tracing or Perfetto UI
+ */
++ (NSDictionary<NSString *, id> *)chromeTraceEvents;
+
+/**
+ Removes all recorded events
+ */
++ (void)clear;
+
+@end
+
+NS_ASSUME_NONNULL_END
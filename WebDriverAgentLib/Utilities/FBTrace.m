@@ -0,0 +1,136 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import "FBTrace.h"
+
+#import <mach/mach_time.h>
+#import <pthread.h>
+#import <stdatomic.h>
+
+/*! The count of the most recent events kept in memory */
+static const NSUInteger FBTraceCapacity = 32768;
+
+typedef struct {
+  const char *name;
+  char phase;
+  uint64_t timestamp;
+  uint64_t threadID;
+  uint64_t requestID;
+} FBTraceEvent;
+
+static FBTraceEvent FBTraceEvents[FBTraceCapacity];
+static NSUInteger FBTraceEventsCount = 0;
+static NSUInteger FBTraceNextEventIndex = 0;
+static pthread_mutex_t FBTraceMutex = PTHREAD_MUTEX_INITIALIZER;
+static _Thread_local uint64_t FBTraceCurrentRequestID = 0;
+static _Atomic(uint64_t) FBTraceLastRequestID = 0;
+
+static void FBTraceRecord(const char *name, char phase)
+{
+  uint64_t threadID;
+  pthread_threadid_np(NULL, &threadID);
+  FBTraceEvent event = {
+    .name = name,
+    .phase = phase,
+    .timestamp = mach_absolute_time(),
+    .threadID = threadID,
+    .requestID = FBTraceCurrentRequestID,
+  };
+  pthread_mutex_lock(&FBTraceMutex);
+  FBTraceEvents[FBTraceNextEventIndex] = event;
+  FBTraceNextEventIndex = (FBTraceNextEventIndex + 1) % FBTraceCapacity;
+  FBTraceEventsCount = MIN(FBTraceEventsCount + 1, FBTraceCapacity);
+  pthread_mutex_unlock(&FBTraceMutex);
+}
+
+void FBTraceBegin(const char *name)
+{
+  FBTraceRecord(name, 'B');
+}
+
+void FBTraceEnd(const char *name)
+{
+  FBTraceRecord(name, 'E');
+}
+
+const char *FBTraceInternName(NSString *name)
+{
+  static NSMutableDictionary<NSString *, NSValue *> *internedNames;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    internedNames = [NSMutableDictionary dictionary];
+  });
+  @synchronized (internedNames) {
+    NSValue *internedName = internedNames[name];
+    if (nil == internedName) {
+      internedName = [NSValue valueWithPointer:strdup(name.UTF8String)];
+      internedNames[name] = internedName;
+    }
+    return internedName.pointerValue;
+  }
+}
+
+void FBTraceSetCurrentRequestID(uint64_t requestID)
+{
+  FBTraceCurrentRequestID = requestID;
+}
+
+uint64_t FBTraceNextRequestID(void)
+{
+  return atomic_fetch_add(&FBTraceLastRequestID, 1) + 1;
+}
+
+@implementation FBTrace
+
++ (NSDictionary<NSString *, id> *)chromeTraceEvents
+{
+  FBTraceEvent *events = malloc(sizeof(FBTraceEvent) * FBTraceCapacity);
+  pthread_mutex_lock(&FBTraceMutex);
+  NSUInteger count = FBTraceEventsCount;
+  NSUInteger firstIndex = (FBTraceNextEventIndex + FBTraceCapacity - count) % FBTraceCapacity;
+  for (NSUInteger index = 0; index < count; index++) {
+    events[index] = FBTraceEvents[(firstIndex + index) % FBTraceCapacity];
+  }
+  pthread_mutex_unlock(&FBTraceMutex);
+
+  mach_timebase_info_data_t timebase;
+  mach_timebase_info(&timebase);
+  int processID = [NSProcessInfo processInfo].processIdentifier;
+  NSMutableArray<NSDictionary *> *traceEvents = [NSMutableArray arrayWithCapacity:count];
+  for (NSUInteger index = 0; index < count; index++) {
+    FBTraceEvent event = events[index];
+    double timestamp = (double)event.timestamp * timebase.numer / timebase.denom / NSEC_PER_USEC;
+    NSMutableDictionary *traceEvent = [@{
+      @"name": [NSString stringWithUTF8String:event.name] ?: @"",
+      @"ph": [NSString stringWithFormat:@"%c", event.phase],
+      @"ts": @(timestamp),
+      @"pid": @(processID),
+      @"tid": @(event.threadID),
+    } mutableCopy];
+    if (event.requestID > 0) {
+      traceEvent[@"args"] = @{@"requestId": @(event.requestID)};
+    }
+    [traceEvents addObject:traceEvent.copy];
+  }
+  free(events);
+  return @{
+    @"traceEvents": traceEvents.copy,
+    @"displayTimeUnit": @"ms",
+  };
+}
+
++ (void)clear
+{
+  pthread_mutex_lock(&FBTraceMutex);
+  FBTraceEventsCount = 0;
+  FBTraceNextEventIndex = 0;
+  pthread_mutex_unlock(&FBTraceMutex);
+}
+
+@end
@@ -0,0 +1,81 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Types the text with the given frequency (letters per sec).
+ If shouldReplaceValue is YES, the current value of the input element must be cleared first.
+ */
+typedef BOOL (^FBTypingFrequencyTunerTyper)(NSString *text, NSUInteger frequency, BOOL shouldReplaceValue, NSError **error);
+
+/**
+ Returns the text the input element currently contains
+ */
+typedef NSString * _Nonnull (^FBTypingFrequencyTunerTextReader)(void);
+
+/**
+ Picks typing frequency based on the results of previous typing attempts on the device.
+ The frequency is increased slowly after successful attempts and halved after failed ones.
+ */
+@interface FBTypingFrequencyTuner : NSObject
+
+/*! Frequency (letters per sec), which should be used for the next typing attempt */
+@property (nonatomic, assign, readonly) NSUInteger frequency;
+
+/*! Count of characters typed with verification */
+@property (nonatomic, assign, readonly) NSUInteger typedCharactersCount;
+
+/*! Count of typing attempts, which resulted in a wrong text */
+@property (nonatomic, assign, readonly) NSUInteger failedAttemptsCount;
+
+/**
+ Tuner of the device the agent is running on. Learned frequency is kept between the agent launches.
+ */
++ (instancetype)sharedTuner;
+
+/**
+ Creates tuner, which does not persist the learned frequency
+
+ @param minimumFrequency the frequency, which is never undercut
+ @param maximumFrequency the frequency to start from
+ */
+- (instancetype)initWithMinimumFrequency:(NSUInteger)minimumFrequency maximumFrequency:(NSUInteger)maximumFrequency;
+
+/**
+ Records the result of typing attempt and adjusts the frequency
+
+ @param count the count of typed characters
+ @param frequency the frequency the characters were typed with
+ @param succeeded whether the resulting text matched the expected one
+ */
+- (void)reportTypedCharactersCount:(NSUInteger)count atFrequency:(NSUInteger)frequency succeeded:(BOOL)succeeded;
+
+/**
+ Types the text with the learned frequency and verifies the resulting text afterwards.
+ If only a part of the text has been accepted, the missing suffix is typed again with a lower frequency.
+ If characters got lost in the middle of the text, the whole value is typed again with the minimum frequency.
+ The last attempt always uses the minimum frequency, which is known to be reliable.
+
+ @param text the text to type
+ @param initialText the text the input element contains before typing
+ @param minimumFrequency the frequency, which is never undercut
+ @param attempts the maximum count of typing attempts
+ @param typer the block, which types the text
+ @param textReader the block, which reads the resulting text
+ @param error If there is an error, upon return contains an NSError object that describes the problem.
+ @return YES if the input element contains the expected text in the end, otherwise NO
+ */
+- (BOOL)typeText:(NSString *)text afterText:(NSString *)initialText minimumFrequency:(NSUInteger)minimumFrequency attempts:(NSUInteger)attempts typer:(FBTypingFrequencyTunerTyper)typer textReader:(FBTypingFrequencyTunerTextReader)textReader error:(NSError **)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,134 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import "FBTypingFrequencyTuner.h"
+
+#import "FBErrorBuilder.h"
+
+static NSString *const FBTypingFrequencyDefaultsKey = @"FBAdaptiveTypingFrequency";
+static NSUInteger const FBMaximumTypingFrequency = 600;
+/*! Lowest learned frequency. Typing never goes below the minimum frequency passed to typeText:... anyway */
+static NSUInteger const FBMinimumTunedTypingFrequency = 10;
+static NSUInteger const FBSuccessfulAttemptsBeforeSpeedUp = 3;
+static NSUInteger const FBMinimumMeaningfulInputLength = 5;
+
+@interface FBTypingFrequencyTuner ()
+@property (nonatomic, assign, readwrite) NSUInteger frequency;
+@property (nonatomic, assign, readwrite) NSUInteger typedCharactersCount;
+@property (nonatomic, assign, readwrite) NSUInteger failedAttemptsCount;
+@property (nonatomic, assign) NSUInteger minimumFrequency;
+@property (nonatomic, assign) NSUInteger maximumFrequency;
+@property (nonatomic, assign) NSUInteger successfulAttemptsInRow;
+@property (nonatomic, assign) BOOL shouldPersistFrequency;
+@end
+
+@implementation FBTypingFrequencyTuner
+
++ (instancetype)sharedTuner
+{
+  static FBTypingFrequencyTuner *instance;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    instance = [[self alloc] initWithMinimumFrequency:FBMinimumTunedTypingFrequency maximumFrequency:FBMaximumTypingFrequency];
+    instance.shouldPersistFrequency = YES;
+    NSUInteger learnedFrequency = (NSUInteger)[[NSUserDefaults standardUserDefaults] integerForKey:FBTypingFrequencyDefaultsKey];
+    if (learnedFrequency > 0) {
+      instance.frequency = MIN(MAX(learnedFrequency, instance.minimumFrequency), instance.maximumFrequency);
+    }
+  });
+  return instance;
+}
+
+- (instancetype)initWithMinimumFrequency:(NSUInteger)minimumFrequency maximumFrequency:(NSUInteger)maximumFrequency
+{
+  self = [super init];
+  if (self) {
+    _minimumFrequency = MAX(minimumFrequency, 1);
+    _maximumFrequency = MAX(maximumFrequency, _minimumFrequency);
+    _frequency = _maximumFrequency;
+  }
+  return self;
+}
+
+- (void)reportTypedCharactersCount:(NSUInteger)count atFrequency:(NSUInteger)frequency succeeded:(BOOL)succeeded
+{
+  @synchronized (self) {
+    self.typedCharactersCount += count;
+    if (succeeded) {
+      // Short inputs tell nothing about the keyboard throughput
+      if (frequency < self.frequency || count < FBMinimumMeaningfulInputLength) {
+        return;
+      }
+      self.successfulAttemptsInRow++;
+      if (self.successfulAttemptsInRow < FBSuccessfulAttemptsBeforeSpeedUp) {
+        return;
+      }
+      self.successfulAttemptsInRow = 0;
+      self.frequency = MIN(self.maximumFrequency, self.frequency + MAX(self.frequency / 4, 1));
+    } else {
+      self.failedAttemptsCount++;
+      self.successfulAttemptsInRow = 0;
+      self.frequency = MAX(self.minimumFrequency, MIN(self.frequency, frequency) / 2);
+    }
+    if (self.shouldPersistFrequency) {
+      [[NSUserDefaults standardUserDefaults] setInteger:(NSInteger)self.frequency forKey:FBTypingFrequencyDefaultsKey];
+    }
+  }
+}
+
+- (BOOL)typeText:(NSString *)text afterText:(NSString *)initialText minimumFrequency:(NSUInteger)minimumFrequency attempts:(NSUInteger)attempts typer:(FBTypingFrequencyTunerTyper)typer textReader:(FBTypingFrequencyTunerTextReader)textReader error:(NSError **)error
+{
+  NSString *expectedText = [initialText stringByAppendingString:text];
+  NSString *textToType = text;
+  NSString *actualText = initialText;
+  for (NSUInteger attempt = 0; attempt < attempts; attempt++) {
+    BOOL isLastAttempt = attempt + 1 == attempts;
+    NSUInteger frequency = isLastAttempt ? minimumFrequency : MAX(self.frequency, minimumFrequency);
+    if (!typer(textToType, frequency, NO, error)) {
+      return NO;
+    }
+    actualText = textReader();
+    BOOL succeeded = [actualText isEqualToString:expectedText];
+    [self reportTypedCharactersCount:textToType.length atFrequency:frequency succeeded:succeeded];
+    if (succeeded) {
+      return YES;
+    }
+    if (![expectedText hasPrefix:actualText]) {
+      // A character has been dropped or autocorrected in the middle of the text, so appending cannot fix it
+      return [self replaceTextWith:expectedText minimumFrequency:minimumFrequency typer:typer textReader:textReader error:error];
+    }
+    textToType = [expectedText substringFromIndex:actualText.length];
+  }
+  return [[[FBErrorBuilder builder]
+    withDescriptionFormat:@"Failed to type '%@' in %lu attempts. Expected text '%@', but got '%@'", text, (unsigned long)attempts, expectedText, actualText]
+   buildError:error];
+}
+
+- (BOOL)replaceTextWith:(NSString *)expectedText minimumFrequency:(NSUInteger)minimumFrequency typer:(FBTypingFrequencyTunerTyper)typer textReader:(FBTypingFrequencyTunerTextReader)textReader error:(NSError **)error
+{
+  if (!typer(expectedText, minimumFrequency, YES, error)) {
+    return NO;
+  }
+  NSString *actualText = textReader();
+  BOOL succeeded = [actualText isEqualToString:expectedText];
+  [self reportTypedCharactersCount:expectedText.length atFrequency:minimumFrequency succeeded:succeeded];
+  if (succeeded) {
+    return YES;
+  }
+  return [[[FBErrorBuilder builder]
+    withDescriptionFormat:@"Typed text '%@' does not match the expected '%@' even after retyping it with %lu letters per second", actualText, expectedText, (unsigned long)minimumFrequency]
+   buildError:error];
+}
+
+- (NSString *)description
+{
+  return [NSString stringWithFormat:@"%@ frequency: %lu, typed characters: %lu, failed attempts: %lu", super.description, (unsigned long)self.frequency, (unsigned long)self.typedCharactersCount, (unsigned long)self.failedAttemptsCount];
+}
+
+@end
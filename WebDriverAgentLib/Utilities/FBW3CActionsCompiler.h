@@ -0,0 +1,87 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <CoreGraphics/CoreGraphics.h>
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Types of events produced by actions compilation
+ */
+typedef NS_ENUM(NSUInteger, FBW3CActionEventType) {
+  FBW3CActionEventTypePointerDown,
+  FBW3CActionEventTypePointerMove,
+  FBW3CActionEventTypePointerUp,
+  FBW3CActionEventTypeKeyDown,
+};
+
+/**
+ Returns center point of the element with given UUID in screen coordinates or nil if there is no such element
+ */
+typedef NSValue * _Nullable (^FBW3CActionsElementCenterResolver)(NSString *elementUUID);
+
+/**
+ Single event on the compiled actions timeline
+ */
+@interface FBW3CActionEvent : NSObject
+
+/*! Event type */
+@property (nonatomic, assign, readonly) FBW3CActionEventType type;
+
+/*! Time offset of the event in seconds since the beginning of the action sequence */
+@property (nonatomic, assign, readonly) NSTimeInterval offset;
+
+/*! Screen point of pointer events */
+@property (nonatomic, assign, readonly) CGPoint point;
+
+/*! Text to type for key events */
+@property (nonatomic, copy, readonly, nullable) NSString *value;
+
++ (instancetype)eventWithType:(FBW3CActionEventType)type offset:(NSTimeInterval)offset point:(CGPoint)point value:(nullable NSString *)value;
+
+@end
+
+/**
+ Sequence of events, which belong to a single touch (from pointer down till pointer up)
+ or to a single key input source
+ */
+@interface FBW3CActionEventPath : NSObject
+
+/*! Identifier of the input source the path belongs to */
+@property (nonatomic, copy, readonly) NSString *sourceId;
+
+/*! YES if the path contains key events, NO if it contains pointer events */
+@property (nonatomic, assign, readonly) BOOL isKeyPath;
+
+/*! Events sorted by offset */
+@property (nonatomic, copy, readonly) NSArray<FBW3CActionEvent *> *events;
+
+@end
+
+/**
+ Compiles W3C action sequences (https://www.w3.org/TR/webdriver/#actions) into event timelines,
+ which can then be delivered to the device in a single event synthesis call.
+ The compiler does not depend on XCTest.
+ */
+@interface FBW3CActionsCompiler : NSObject
+
+/**
+ Compiles the given W3C actions into event paths
+
+ @param actions the value of 'actions' argument of W3C actions request
+ @param elementCenterResolver the block used to resolve element origins of pointer move actions
+ @param error If there is an error, upon return contains an NSError object that describes the problem.
+ @return event paths ordered by the time of their first event or nil in case of failure
+ */
++ (nullable NSArray<FBW3CActionEventPath *> *)compileActions:(NSArray<NSDictionary *> *)actions elementCenterResolver:(FBW3CActionsElementCenterResolver)elementCenterResolver error:(NSError **)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,380 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import "FBW3CActionsCompiler.h"
+
+#import <UIKit/UIKit.h>
+
+#import "FBErrorBuilder.h"
+
+static NSString *const FBW3CSourceTypePointer = @"pointer";
+static NSString *const FBW3CSourceTypeKey = @"key";
+static NSString *const FBW3CSourceTypeNone = @"none";
+
+static NSString *const FBW3CActionTypePause = @"pause";
+static NSString *const FBW3CActionTypePointerMove = @"pointerMove";
+static NSString *const FBW3CActionTypePointerDown = @"pointerDown";
+static NSString *const FBW3CActionTypePointerUp = @"pointerUp";
+static NSString *const FBW3CActionTypeKeyDown = @"keyDown";
+static NSString *const FBW3CActionTypeKeyUp = @"keyUp";
+
+static NSString *const FBW3COriginViewport = @"viewport";
+static NSString *const FBW3COriginPointer = @"pointer";
+static NSArray<NSString *> *FBW3CElementKeys(void)
+{
+  return @[@"element-6066-11e4-a52e-4f735466cecf", @"ELEMENT"];
+}
+
+@interface FBW3CActionEvent ()
+@property (nonatomic, assign, readwrite) FBW3CActionEventType type;
+@property (nonatomic, assign, readwrite) NSTimeInterval offset;
+@property (nonatomic, assign, readwrite) CGPoint point;
+@property (nonatomic, copy, readwrite) NSString *value;
+@end
+
+@implementation FBW3CActionEvent
+
++ (instancetype)eventWithType:(FBW3CActionEventType)type offset:(NSTimeInterval)offset point:(CGPoint)point value:(NSString *)value
+{
+  FBW3CActionEvent *event = [self.class new];
+  event.type = type;
+  event.offset = offset;
+  event.point = point;
+  event.value = value;
+  return event;
+}
+
+- (NSString *)description
+{
+  if (self.type == FBW3CActionEventTypeKeyDown) {
+    return [NSString stringWithFormat:@"keyDown '%@' @%.3f", self.value, self.offset];
+  }
+  NSString *name = self.type == FBW3CActionEventTypePointerDown ? @"down" : (self.type == FBW3CActionEventTypePointerUp ? @"up" : @"move");
+  return [NSString stringWithFormat:@"%@ %@ @%.3f", name, NSStringFromCGPoint(self.point), self.offset];
+}
+
+@end
+
+
+@interface FBW3CActionEventPath ()
+@property (nonatomic, copy, readwrite) NSString *sourceId;
+@property (nonatomic, assign, readwrite) BOOL isKeyPath;
+@property (nonatomic, strong) NSMutableArray<FBW3CActionEvent *> *mutableEvents;
+@end
+
+@implementation FBW3CActionEventPath
+
+- (instancetype)initWithSourceId:(NSString *)sourceId isKeyPath:(BOOL)isKeyPath
+{
+  self = [super init];
+  if (self) {
+    _sourceId = [sourceId copy];
+    _isKeyPath = isKeyPath;
+    _mutableEvents = [NSMutableArray array];
+  }
+  return self;
+}
+
+- (NSArray<FBW3CActionEvent *> *)events
+{
+  return self.mutableEvents.copy;
+}
+
+- (NSString *)description
+{
+  return [NSString stringWithFormat:@"%@: %@", self.sourceId, [self.mutableEvents componentsJoinedByString:@", "]];
+}
+
+@end
+
+
+/**
+ Keeps the state of a single input source while its actions are being compiled
+ */
+@interface FBW3CInputSource : NSObject
+@property (nonatomic, copy) NSString *identifier;
+@property (nonatomic, copy) NSString *type;
+@property (nonatomic, copy) NSArray<NSDictionary *> *actions;
+@property (nonatomic, assign) CGPoint position;
+@property (nonatomic, strong) FBW3CActionEventPath *currentPath;
+@end
+
+@implementation FBW3CInputSource
+@end
+
+
+@implementation FBW3CActionsCompiler
+
++ (NSArray<FBW3CActionEventPath *> *)compileActions:(NSArray<NSDictionary *> *)actions elementCenterResolver:(FBW3CActionsElementCenterResolver)elementCenterResolver error:(NSError **)error
+{
+  NSArray<FBW3CInputSource *> *sources = [self inputSourcesWithActions:actions error:error];
+  if (nil == sources) {
+    return nil;
+  }
+  NSUInteger ticksCount = 0;
+  for (FBW3CInputSource *source in sources) {
+    ticksCount = MAX(ticksCount, source.actions.count);
+  }
+
+  NSMutableArray<FBW3CActionEventPath *> *paths = [NSMutableArray array];
+  NSTimeInterval tickStart = 0;
+  for (NSUInteger tick = 0; tick < ticksCount; tick++) {
+    NSTimeInterval tickDuration = 0;
+    for (FBW3CInputSource *source in sources) {
+      if (tick >= source.actions.count) {
+        continue;
+      }
+      NSDictionary *action = source.actions[tick];
+      NSNumber *duration = [self durationOfAction:action source:source error:error];
+      if (nil == duration) {
+        return nil;
+      }
+      tickDuration = MAX(tickDuration, duration.doubleValue);
+      if (![self compileAction:action
+                      ofSource:source
+                        atTime:tickStart
+                      duration:duration.doubleValue
+         elementCenterResolver:elementCenterResolver
+                         paths:paths
+                         error:error]) {
+        return nil;
+      }
+    }
+    tickStart += tickDuration;
+  }
+  // Touches, which are still pressed after the last tick, are released, since XCTest requires each touch path to be finished
+  for (FBW3CInputSource *source in sources) {
+    FBW3CActionEventPath *path = source.currentPath;
+    if (nil == path || path.isKeyPath) {
+      continue;
+    }
+    [path.mutableEvents addObject:[FBW3CActionEvent eventWithType:FBW3CActionEventTypePointerUp offset:tickStart point:source.position value:nil]];
+    source.currentPath = nil;
+  }
+  NSMutableArray<FBW3CActionEventPath *> *result = [NSMutableArray array];
+  for (FBW3CActionEventPath *path in paths) {
+    if (path.mutableEvents.count > 0) {
+      [result addObject:path];
+    }
+  }
+  return result.copy;
+}
+
+#pragma mark - Private
+
++ (NSArray<FBW3CInputSource *> *)inputSourcesWithActions:(NSArray<NSDictionary *> *)actions error:(NSError **)error
+{
+  if (![actions isKindOfClass:NSArray.class]) {
+    return [self failWithError:error description:@"'actions' argument is expected to be an array of input sources"];
+  }
+  NSMutableArray<FBW3CInputSource *> *sources = [NSMutableArray array];
+  NSMutableSet<NSString *> *identifiers = [NSMutableSet set];
+  for (NSDictionary *sourceInfo in actions) {
+    if (![sourceInfo isKindOfClass:NSDictionary.class]) {
+      return [self failWithError:error description:[NSString stringWithFormat:@"Input source '%@' is expected to be an object", sourceInfo]];
+    }
+    NSString *identifier = sourceInfo[@"id"];
+    NSString *type = sourceInfo[@"type"];
+    NSArray *sourceActions = sourceInfo[@"actions"];
+    if (![identifier isKindOfClass:NSString.class] || [identifiers containsObject:identifier]) {
+      return [self failWithError:error description:[NSString stringWithFormat:@"Input source %@ must have a unique string 'id'", sourceInfo]];
+    }
+    if (![@[FBW3CSourceTypePointer, FBW3CSourceTypeKey, FBW3CSourceTypeNone] containsObject:type]) {
+      return [self failWithError:error description:[NSString stringWithFormat:@"Input source '%@' has unsupported type '%@'", identifier, type]];
+    }
+    if (![sourceActions isKindOfClass:NSArray.class]) {
+      return [self failWithError:error description:[NSString stringWithFormat:@"Input source '%@' must have an array of 'actions'", identifier]];
+    }
+    if ([type isEqualToString:FBW3CSourceTypePointer]) {
+      NSString *pointerType = sourceInfo[@"parameters"][@"pointerType"];
+      if (nil != pointerType && ![pointerType isEqual:@"touch"]) {
+        return [self failWithError:error description:[NSString stringWithFormat:@"Only 'touch' pointer type is supported. '%@' is given for input source '%@'", pointerType, identifier]];
+      }
+    }
+    FBW3CInputSource *source = [FBW3CInputSource new];
+    source.identifier = identifier;
+    source.type = type;
+    source.actions = sourceActions;
+    source.position = CGPointZero;
+    [identifiers addObject:identifier];
+    [sources addObject:source];
+  }
+  return sources.copy;
+}
+
++ (NSNumber *)durationOfAction:(NSDictionary *)action source:(FBW3CInputSource *)source error:(NSError **)error
+{
+  if (![action isKindOfClass:NSDictionary.class]) {
+    return [self failWithError:error description:[NSString stringWithFormat:@"Action '%@' of input source '%@' is expected to be an object", action, source.identifier]];
+  }
+  NSString *type = action[@"type"];
+  if (![type isEqual:FBW3CActionTypePause] && ![type isEqual:FBW3CActionTypePointerMove]) {
+    return @0;
+  }
+  id duration = action[@"duration"];
+  if (nil == duration) {
+    return @0;
+  }
+  if (![duration isKindOfClass:NSNumber.class] || [duration doubleValue] < 0) {
+    return [self failWithError:error description:[NSString stringWithFormat:@"'duration' of '%@' action of input source '%@' must be a non-negative number of milliseconds", type, source.identifier]];
+  }
+  return @([duration doubleValue] / 1000.0);
+}
+
++ (BOOL)compileAction:(NSDictionary *)action
+             ofSource:(FBW3CInputSource *)source
+               atTime:(NSTimeInterval)time
+             duration:(NSTimeInterval)duration
+elementCenterResolver:(FBW3CActionsElementCenterResolver)elementCenterResolver
+                paths:(NSMutableArray<FBW3CActionEventPath *> *)paths
+                error:(NSError **)error
+{
+  NSString *type = action[@"type"];
+  if ([type isEqual:FBW3CActionTypePause]) {
+    return YES;
+  }
+  if ([source.type isEqualToString:FBW3CSourceTypePointer]) {
+    if ([type isEqual:FBW3CActionTypePointerMove]) {
+      NSValue *target = [self targetOfMoveAction:action source:source elementCenterResolver:elementCenterResolver error:error];
+      if (nil == target) {
+        return NO;
+      }
+      source.position = target.CGPointValue;
+      if (nil != source.currentPath) {
+        [source.currentPath.mutableEvents addObject:[FBW3CActionEvent eventWithType:FBW3CActionEventTypePointerMove offset:time + duration point:source.position value:nil]];
+      }
+      return YES;
+    }
+    if ([type isEqual:FBW3CActionTypePointerDown]) {
+      // Pressing an already pressed pointer has no effect
+      if (nil == source.currentPath) {
+        source.currentPath = [[FBW3CActionEventPath alloc] initWithSourceId:source.identifier isKeyPath:NO];
+        [source.currentPath.mutableEvents addObject:[FBW3CActionEvent eventWithType:FBW3CActionEventTypePointerDown offset:time point:source.position value:nil]];
+        [paths addObject:source.currentPath];
+      }
+      return YES;
+    }
+    if ([type isEqual:FBW3CActionTypePointerUp]) {
+      // Releasing a pointer, which is not pressed, has no effect
+      if (nil != source.currentPath) {
+        [source.currentPath.mutableEvents addObject:[FBW3CActionEvent eventWithType:FBW3CActionEventTypePointerUp offset:time point:source.position value:nil]];
+        source.currentPath = nil;
+      }
+      return YES;
+    }
+  } else if ([source.type isEqualToString:FBW3CSourceTypeKey]) {
+    if ([type isEqual:FBW3CActionTypeKeyDown] || [type isEqual:FBW3CActionTypeKeyUp]) {
+      NSString *value = action[@"value"];
+      if (![value isKindOfClass:NSString.class] || 0 == value.length || [value rangeOfComposedCharacterSequenceAtIndex:0].length != value.length) {
+        return
+        [[[FBErrorBuilder builder]
+          withDescriptionFormat:@"'value' of '%@' action of input source '%@' must be a single character", type, source.identifier]
+         buildError:error];
+      }
+      NSString *text = [self textForKeyValue:value];
+      if (nil == text) {
+        return
+        [[[FBErrorBuilder builder]
+          withDescriptionFormat:@"Key with code \\u%04X of input source '%@' is not supported", [value characterAtIndex:0], source.identifier]
+         buildError:error];
+      }
+      if ([type isEqual:FBW3CActionTypeKeyUp] || 0 == text.length) {
+        return YES;
+      }
+      if (nil == source.currentPath) {
+        source.currentPath = [[FBW3CActionEventPath alloc] initWithSourceId:source.identifier isKeyPath:YES];
+        [paths addObject:source.currentPath];
+      }
+      [source.currentPath.mutableEvents addObject:[FBW3CActionEvent eventWithType:FBW3CActionEventTypeKeyDown offset:time point:CGPointZero value:text]];
+      return YES;
+    }
+  }
+  return
+  [[[FBErrorBuilder builder]
+    withDescriptionFormat:@"Action type '%@' is not supported by '%@' input source '%@'", type, source.type, source.identifier]
+   buildError:error];
+}
+
++ (NSValue *)targetOfMoveAction:(NSDictionary *)action source:(FBW3CInputSource *)source elementCenterResolver:(FBW3CActionsElementCenterResolver)elementCenterResolver error:(NSError **)error
+{
+  id x = action[@"x"] ?: @0;
+  id y = action[@"y"] ?: @0;
+  if (![x isKindOfClass:NSNumber.class] || ![y isKindOfClass:NSNumber.class]) {
+    return [self failWithError:error description:[NSString stringWithFormat:@"'x' and 'y' of pointerMove action of input source '%@' must be numbers", source.identifier]];
+  }
+  CGPoint offset = CGPointMake((CGFloat)[x doubleValue], (CGFloat)[y doubleValue]);
+  id origin = action[@"origin"] ?: FBW3COriginViewport;
+  if ([origin isEqual:FBW3COriginViewport]) {
+    return [NSValue valueWithCGPoint:offset];
+  }
+  if ([origin isEqual:FBW3COriginPointer]) {
+    return [NSValue valueWithCGPoint:CGPointMake(source.position.x + offset.x, source.position.y + offset.y)];
+  }
+  NSString *elementUUID = nil;
+  if ([origin isKindOfClass:NSDictionary.class]) {
+    for (NSString *key in FBW3CElementKeys()) {
+      if ([origin[key] isKindOfClass:NSString.class]) {
+        elementUUID = origin[key];
+        break;
+      }
+    }
+  }
+  if (nil == elementUUID) {
+    return [self failWithError:error description:[NSString stringWithFormat:@"Unsupported origin '%@' of pointerMove action of input source '%@'", origin, source.identifier]];
+  }
+  NSValue *center = elementCenterResolver(elementUUID);
+  if (nil == center) {
+    return [self failWithError:error description:[NSString stringWithFormat:@"Element '%@' used as pointerMove origin of input source '%@' does not exist", elementUUID, source.identifier]];
+  }
+  return [NSValue valueWithCGPoint:CGPointMake(center.CGPointValue.x + offset.x, center.CGPointValue.y + offset.y)];
+}
+
+/**
+ Converts W3C key value into the text to type. Modifier keys have no effect on the software keyboard,
+ so empty string is returned for them. nil is returned for unsupported special keys.
+ */
++ (NSString *)textForKeyValue:(NSString *)value
+{
+  static NSDictionary<NSNumber *, NSString *> *specialKeys;
+  static NSRange modifierKeys[] = {{0xE008, 3}, {0xE03D, 1}, {0xE050, 4}};
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    specialKeys = @{
+      @0xE003: @"\b",
+      @0xE004: @"\t",
+      @0xE006: @"\n",
+      @0xE007: @"\n",
+      @0xE00D: @" ",
+      @0xE017: @"\x7F",
+    };
+  });
+  unichar code = [value characterAtIndex:0];
+  if (value.length > 1 || code < 0xE000 || code > 0xF8FF) {
+    return value;
+  }
+  if (specialKeys[@(code)]) {
+    return specialKeys[@(code)];
+  }
+  for (NSUInteger i = 0; i < sizeof(modifierKeys) / sizeof(modifierKeys[0]); i++) {
+    if (NSLocationInRange(code, modifierKeys[i])) {
+      return @"";
+    }
+  }
+  return nil;
+}
+
++ (id)failWithError:(NSError **)error description:(NSString *)description
+{
+  [[[FBErrorBuilder builder]
+    withDescription:description]
+   buildError:error];
+  return nil;
+}
+
+@end
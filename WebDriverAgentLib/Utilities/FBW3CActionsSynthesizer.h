@@ -0,0 +1,40 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <XCTest/XCTest.h>
+
+@class FBElementCache, XCSynthesizedEventRecord;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Converts W3C actions into a single synthesized event record
+ */
+@interface FBW3CActionsSynthesizer : NSObject
+
+/**
+ Creates synthesizer for the given actions
+
+ @param actions the value of 'actions' argument of W3C actions request
+ @param application the application under test
+ @param elementCache the cache used to resolve element origins of pointer move actions
+ */
+- (instancetype)initWithActions:(NSArray<NSDictionary *> *)actions forApplication:(XCUIApplication *)application elementCache:(nullable FBElementCache *)elementCache;
+
+/**
+ Compiles the actions into an event record, which can be delivered in a single synthesis call
+
+ @param error If there is an error, upon return contains an NSError object that describes the problem.
+ @return event record or nil in case of failure
+ */
+- (nullable XCSynthesizedEventRecord *)synthesizeWithError:(NSError **)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
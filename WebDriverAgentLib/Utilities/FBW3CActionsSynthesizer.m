@@ -0,0 +1,107 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import "FBW3CActionsSynthesizer.h"
+
+#import "FBConfiguration.h"
+#import "FBElementCache.h"
+#import "FBErrorBuilder.h"
+#import "FBMathUtils.h"
+#import "FBW3CActionsCompiler.h"
+#import "XCPointerEventPath.h"
+#import "XCSynthesizedEventRecord.h"
+#import "XCUIApplication.h"
+#import "XCUIElement.h"
+
+@interface FBW3CActionsSynthesizer ()
+@property (nonatomic, copy) NSArray<NSDictionary *> *actions;
+@property (nonatomic, strong) XCUIApplication *application;
+@property (nonatomic, strong, nullable) FBElementCache *elementCache;
+@end
+
+@implementation FBW3CActionsSynthesizer
+
+- (instancetype)initWithActions:(NSArray<NSDictionary *> *)actions forApplication:(XCUIApplication *)application elementCache:(FBElementCache *)elementCache
+{
+  self = [super init];
+  if (self) {
+    _actions = actions;
+    _application = application;
+    _elementCache = elementCache;
+  }
+  return self;
+}
+
+- (XCSynthesizedEventRecord *)synthesizeWithError:(NSError **)error
+{
+  FBElementCache *elementCache = self.elementCache;
+  NSArray<FBW3CActionEventPath *> *paths = [FBW3CActionsCompiler compileActions:self.actions elementCenterResolver:^NSValue *(NSString *elementUUID) {
+    XCUIElement *element = [elementCache elementForUUID:elementUUID];
+    return nil == element ? nil : [NSValue valueWithCGPoint:FBRectGetCenter(element.frame)];
+  } error:error];
+  if (nil == paths) {
+    return nil;
+  }
+  if (0 == paths.count) {
+    [[[FBErrorBuilder builder]
+      withDescription:@"The given actions do not contain any pointer or key events"]
+     buildError:error];
+    return nil;
+  }
+
+  XCSynthesizedEventRecord *eventRecord = [[XCSynthesizedEventRecord alloc] initWithName:@"W3C Actions" interfaceOrientation:self.application.interfaceOrientation];
+  for (FBW3CActionEventPath *path in paths) {
+    XCPointerEventPath *eventPath = path.isKeyPath ? [self keyEventPathWithPath:path error:error] : [self touchEventPathWithPath:path];
+    if (nil == eventPath) {
+      return nil;
+    }
+    [eventRecord addPointerEventPath:eventPath];
+  }
+  return eventRecord;
+}
+
+#pragma mark - Private
+
+- (XCPointerEventPath *)touchEventPathWithPath:(FBW3CActionEventPath *)path
+{
+  XCPointerEventPath *eventPath = nil;
+  for (FBW3CActionEvent *event in path.events) {
+    switch (event.type) {
+      case FBW3CActionEventTypePointerDown:
+        eventPath = [[XCPointerEventPath alloc] initForTouchAtPoint:event.point offset:event.offset];
+        break;
+      case FBW3CActionEventTypePointerMove:
+        [eventPath moveToPoint:event.point atOffset:event.offset];
+        break;
+      case FBW3CActionEventTypePointerUp:
+        [eventPath liftUpAtOffset:event.offset];
+        break;
+      case FBW3CActionEventTypeKeyDown:
+        break;
+    }
+  }
+  return eventPath;
+}
+
+- (XCPointerEventPath *)keyEventPathWithPath:(FBW3CActionEventPath *)path error:(NSError **)error
+{
+  if (![XCPointerEventPath instancesRespondToSelector:@selector(initForTextInput)]) {
+    [[[FBErrorBuilder builder]
+      withDescriptionFormat:@"Key actions of input source '%@' require Xcode 10 or newer", path.sourceId]
+     buildError:error];
+    return nil;
+  }
+  XCPointerEventPath *eventPath = [[XCPointerEventPath alloc] initForTextInput];
+  for (FBW3CActionEvent *event in path.events) {
+    [eventPath typeText:event.value atOffset:event.offset typingSpeed:[FBConfiguration maxTypingFrequency] shouldRedact:NO];
+  }
+  return eventPath;
+}
+
+@end
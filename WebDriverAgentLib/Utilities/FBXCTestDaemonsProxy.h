@@ -9,8 +9,11 @@
 
 #import <Foundation/Foundation.h>
 
+@class XCSynthesizedEventRecord;
 @protocol XCTestManager_ManagerInterface;
 
+NS_ASSUME_NONNULL_BEGIN
+
 /**
  Temporary class used to abstract interactions with TestManager daemon between Xcode 8.2.1 and Xcode 8.3-beta
  */
@@ -18,4 +21,26 @@
 
 + (id<XCTestManager_ManagerInterface>)testRunnerProxy;
 
+/**
+ Sends the given event record to the test manager daemon and spins the run loop until it is delivered
+
+ @param record the event record to synthesize
+ @param error If there is an error, upon return contains an NSError object that describes the problem.
+ @return YES if the operation succeeds, otherwise NO.
+ */
++ (BOOL)synthesizeEventWithRecord:(XCSynthesizedEventRecord *)record error:(NSError **)error;
+
+/**
+ Requests the screenshot of the whole screen from the test manager daemon.
+ Unlike XCUIScreen APIs this call does not depend on the main thread, so it can be used from background queues.
+ The calling thread is blocked until the screenshot is received.
+
+ @param timeout the maximum amount of seconds to wait for the screenshot
+ @param error If there is an error, upon return contains an NSError object that describes the problem.
+ @return the screenshot data or nil in case of failure
+ */
++ (nullable NSData *)screenshotWithTimeout:(NSTimeInterval)timeout error:(NSError **)error;
+
 @end
+
+NS_ASSUME_NONNULL_END
@@ -8,6 +8,11 @@
  */
 
 #import "FBXCTestDaemonsProxy.h"
+
+#import "FBAlertsMonitor.h"
+#import "FBErrorBuilder.h"
+#import "FBRunLoopSpinner.h"
+#import "FBTrace.h"
 #import "XCTestDriver.h"
 #import "XCTRunnerDaemonSession.h"
 #import <objc/runtime.h>
@@ -30,4 +35,49 @@
   return proxy;
 }
 
++ (BOOL)synthesizeEventWithRecord:(XCSynthesizedEventRecord *)record error:(NSError **)error
+{
+  __block BOOL didSucceed = NO;
+  __block NSError *innerError;
+  FBTraceBegin("_XCT_synthesizeEvent");
+  [FBRunLoopSpinner spinUntilCompletion:^(void(^completion)(void)){
+    [[self testRunnerProxy] _XCT_synthesizeEvent:record completion:^(NSError *invokeError) {
+      innerError = invokeError;
+      didSucceed = (invokeError == nil);
+      completion();
+    }];
+  }];
+  FBTraceEnd("_XCT_synthesizeEvent");
+  [[FBAlertsMonitor sharedMonitor] invalidate];
+  if (error) {
+    *error = innerError;
+  }
+  return didSucceed;
+}
+
++ (NSData *)screenshotWithTimeout:(NSTimeInterval)timeout error:(NSError **)error
+{
+  __block NSData *screenshotData;
+  __block NSError *innerError;
+  dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
+  FBTraceBegin("_XCT_requestScreenshot");
+  [[self testRunnerProxy] _XCT_requestScreenshotWithReply:^(NSData *data, NSError *requestError) {
+    screenshotData = data;
+    innerError = requestError;
+    dispatch_semaphore_signal(semaphore);
+  }];
+  BOOL isTimedOut = 0 != dispatch_semaphore_wait(semaphore, dispatch_time(DISPATCH_TIME_NOW, (int64_t)(timeout * NSEC_PER_SEC)));
+  FBTraceEnd("_XCT_requestScreenshot");
+  if (isTimedOut) {
+    [[[FBErrorBuilder builder]
+      withDescriptionFormat:@"Cannot receive the screenshot within %.2f seconds timeout", timeout]
+     buildError:error];
+    return nil;
+  }
+  if (nil == screenshotData && error) {
+    *error = innerError ?: [[FBErrorBuilder.builder withDescription:@"Cannot take a screenshot of the current screen state"] build];
+  }
+  return screenshotData;
+}
+
 @end
@@ -31,6 +31,8 @@ FOUNDATION_EXPORT const unsigned char WebDriverAgentLib_VersionString[];
 #import <WebDriverAgentLib/FBKeyboard.h>
 #import <WebDriverAgentLib/FBLogger.h>
 #import <WebDriverAgentLib/FBMacros.h>
+#import <WebDriverAgentLib/FBResponseDataPayload.h>
+#import <WebDriverAgentLib/FBScreenStream.h>
 #import <WebDriverAgentLib/FBResponseFilePayload.h>
 #import <WebDriverAgentLib/FBResponseJSONPayload.h>
 #import <WebDriverAgentLib/FBResponsePayload.h>
@@ -62,6 +62,19 @@
   FBAssertVisibleCell(@"10");
 }
 
+- (void)testMultiSegmentScrollWithDuration
+{
+  FBAssertVisibleCell(@"0");
+  NSError *error;
+  XCTAssertTrue([self.scrollView fb_scrollByNormalizedVector:CGVectorMake(0.0, -3.0) duration:2.0 error:&error]);
+  XCTAssertNil(error);
+  FBAssertInvisibleCell(@"0");
+  FBAssertInvisibleCell(@"10");
+  XCTAssertTrue([self.scrollView fb_scrollByNormalizedVector:CGVectorMake(0.0, 3.0) duration:0 error:&error]);
+  XCTAssertNil(error);
+  FBAssertVisibleCell(@"0");
+}
+
 - (void)testScrollToVisible
 {
   NSString *cellName = @"30";
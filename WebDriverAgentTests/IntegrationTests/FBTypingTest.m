@@ -9,6 +9,7 @@
 
 #import <XCTest/XCTest.h>
 
+#import "FBConfiguration.h"
 #import "FBIntegrationTestCase.h"
 #import "XCUIElement+FBTyping.h"
 
@@ -46,6 +47,16 @@
   XCTAssertEqualObjects(textField.value, text);
 }
 
+- (void)testConsecutiveTextTyping
+{
+  XCUIElement *textField = self.testedApplication.textFields[@"aIdentifier"];
+  NSError *error;
+  XCTAssertTrue([textField fb_typeText:@"Happy " error:&error]);
+  XCTAssertTrue([textField fb_typeText:@"typing" error:&error]);
+  XCTAssertNil(error);
+  XCTAssertEqualObjects(textField.value, @"Happy typing");
+}
+
 - (void)testTextClearing
 {
   XCUIElement *textField = self.testedApplication.textFields[@"aIdentifier"];
@@ -58,4 +69,16 @@
   XCTAssertEqualObjects(textField.value, @"");
 }
 
+- (void)testTextReplacing
+{
+  NSString *text = @"Happy typing";
+  XCUIElement *textField = self.testedApplication.textFields[@"aIdentifier"];
+  [textField tap];
+  [textField typeText:@"Previous text"];
+  NSError *error;
+  XCTAssertTrue([textField fb_typeText:text shouldClear:YES frequency:[FBConfiguration maxTypingFrequency] error:&error]);
+  XCTAssertNil(error);
+  XCTAssertEqualObjects(textField.value, text);
+}
+
 @end
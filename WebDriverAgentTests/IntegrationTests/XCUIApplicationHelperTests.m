@@ -60,6 +60,23 @@
   XCTAssertNotNil(self.testedApplication.fb_accessibilityTree);
 }
 
+- (void)testAccessibilityTreeContainsAccessibleElements
+{
+  NSMutableArray<NSString *> *labels = [NSMutableArray array];
+  NSMutableArray<NSDictionary *> *nodes = [NSMutableArray arrayWithObject:self.testedApplication.fb_accessibilityTree];
+  while (nodes.count > 0) {
+    NSDictionary *node = nodes.lastObject;
+    [nodes removeLastObject];
+    if ([node[@"label"] isKindOfClass:NSString.class]) {
+      [labels addObject:node[@"label"]];
+    }
+    // Accessible elements are leaves of the accessibility tree
+    XCTAssertFalse(nil != node[@"label"] && nil != node[@"children"]);
+    [nodes addObjectsFromArray:node[@"children"] ?: @[]];
+  }
+  XCTAssertTrue([labels containsObject:@"Alerts"]);
+}
+
 - (void)testDeactivateApplication
 {
   [self.testedApplication query];
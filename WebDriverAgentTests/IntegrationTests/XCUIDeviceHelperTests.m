@@ -11,6 +11,7 @@
 
 #import "FBIntegrationTestCase.h"
 #import "FBApplication.h"
+#import "FBImageUtils.h"
 #import "XCUIDevice+FBHelpers.h"
 
 @interface XCUIDeviceHelperTests : FBIntegrationTestCase
@@ -32,6 +33,16 @@
   NSError *error = nil;
   NSData *screenshotData = [[XCUIDevice sharedDevice] fb_screenshotWithError:&error];
   XCTAssertNotNil([UIImage imageWithData:screenshotData]);
+  XCTAssertEqualObjects(FBImageMimeType(screenshotData), FBImageMimeTypePNG);
+  XCTAssertNil(error);
+}
+
+- (void)testRawScreenshot
+{
+  NSError *error = nil;
+  NSData *screenshotData = [[XCUIDevice sharedDevice] fb_rawScreenshotWithError:&error];
+  XCTAssertNotNil([UIImage imageWithData:screenshotData]);
+  XCTAssertNotNil(FBImageMimeType(screenshotData));
   XCTAssertNil(error);
 }
 
@@ -19,7 +19,7 @@
 {
   self = [super init];
   if (self) {
-    _bundleID = @"some.bundle.identifier";
+    _bundleID = @"com.facebook.awesome";
   }
   return self;
 }
@@ -29,14 +29,14 @@
   self.didTerminate = YES;
 }
 
-- (NSUInteger)processID
+- (BOOL)running
 {
-  return 0;
+  return !self.didTerminate;
 }
 
-- (NSString *)bundleID
+- (NSUInteger)processID
 {
-  return @"com.facebook.awesome";
+  return 0;
 }
 
 - (void)resolve
@@ -0,0 +1,103 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <XCTest/XCTest.h>
+
+#import "FBAlertsMonitor.h"
+
+@interface FBAlertsMonitorTests : XCTestCase
+@property (nonatomic, strong) FBAlertsMonitor *monitor;
+@property (nonatomic, assign) NSUInteger lookupsCount;
+@property (nonatomic, strong) id alert;
+@end
+
+@implementation FBAlertsMonitorTests
+
+- (void)setUp
+{
+  [super setUp];
+  self.monitor = [FBAlertsMonitor new];
+  self.monitor.cacheTimeout = 60;
+  self.lookupsCount = 0;
+  self.alert = [NSObject new];
+}
+
+- (FBAlertsMonitorLookup)lookup
+{
+  return ^XCUIElement *{
+    self.lookupsCount++;
+    return self.alert;
+  };
+}
+
+- (void)testAlertStateIsCached
+{
+  XCTAssertEqual([self.monitor alertElementForApplicationWithBundleID:@"app" lookup:self.lookup], self.alert);
+  XCTAssertEqual([self.monitor alertElementForApplicationWithBundleID:@"app" lookup:self.lookup], self.alert);
+  XCTAssertEqual(self.lookupsCount, 1);
+}
+
+- (void)testAbsentAlertIsCached
+{
+  self.alert = nil;
+  XCTAssertNil([self.monitor alertElementForApplicationWithBundleID:@"app" lookup:self.lookup]);
+  XCTAssertNil([self.monitor alertElementForApplicationWithBundleID:@"app" lookup:self.lookup]);
+  XCTAssertEqual(self.lookupsCount, 1);
+}
+
+- (void)testApplicationsAreCachedSeparately
+{
+  [self.monitor alertElementForApplicationWithBundleID:@"app" lookup:self.lookup];
+  [self.monitor alertElementForApplicationWithBundleID:@"otherApp" lookup:self.lookup];
+  XCTAssertEqual(self.lookupsCount, 2);
+}
+
+- (void)testLookupTimestamp
+{
+  XCTAssertNil([self.monitor lookupTimestampOfApplicationWithBundleID:@"app"]);
+  NSTimeInterval lookupStart = [NSProcessInfo processInfo].systemUptime;
+  [self.monitor alertElementForApplicationWithBundleID:@"app" lookup:self.lookup];
+  NSNumber *timestamp = [self.monitor lookupTimestampOfApplicationWithBundleID:@"app"];
+  XCTAssertNotNil(timestamp);
+  XCTAssertGreaterThanOrEqual(timestamp.doubleValue, lookupStart);
+  XCTAssertLessThanOrEqual(timestamp.doubleValue, [NSProcessInfo processInfo].systemUptime);
+  [self.monitor invalidate];
+  XCTAssertNil([self.monitor lookupTimestampOfApplicationWithBundleID:@"app"]);
+}
+
+- (void)testInvalidation
+{
+  [self.monitor alertElementForApplicationWithBundleID:@"app" lookup:self.lookup];
+  [self.monitor invalidate];
+  self.alert = nil;
+  XCTAssertNil([self.monitor alertElementForApplicationWithBundleID:@"app" lookup:self.lookup]);
+  XCTAssertEqual(self.lookupsCount, 2);
+}
+
+- (void)testExpiredStateIsNotUsed
+{
+  self.monitor.cacheTimeout = 0;
+  [self.monitor alertElementForApplicationWithBundleID:@"app" lookup:self.lookup];
+  [self.monitor alertElementForApplicationWithBundleID:@"app" lookup:self.lookup];
+  XCTAssertEqual(self.lookupsCount, 2);
+}
+
+- (void)testResultOfLookupInterruptedByInvalidationIsNotCached
+{
+  FBAlertsMonitor *monitor = self.monitor;
+  [monitor alertElementForApplicationWithBundleID:@"app" lookup:^XCUIElement *{
+    self.lookupsCount++;
+    [monitor invalidate];
+    return self.alert;
+  }];
+  [monitor alertElementForApplicationWithBundleID:@"app" lookup:self.lookup];
+  XCTAssertEqual(self.lookupsCount, 2);
+}
+
+@end
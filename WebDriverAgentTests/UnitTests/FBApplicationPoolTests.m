@@ -0,0 +1,86 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <XCTest/XCTest.h>
+
+#import "FBApplicationDouble.h"
+#import "FBApplicationPool.h"
+
+@interface FBApplicationPoolTests : XCTestCase
+@property (nonatomic, strong) FBApplicationPool *pool;
+@end
+
+@implementation FBApplicationPoolTests
+
+- (void)setUp
+{
+  [super setUp];
+  self.pool = [FBApplicationPool new];
+}
+
+- (void)testKeyIgnoresUnrelatedCapabilities
+{
+  NSString *key = [FBApplicationPool keyWithCapabilities:@{@"bundleId": @"com.facebook.awesome", @"maxTypingFrequency": @10}];
+  XCTAssertEqualObjects(key, [FBApplicationPool keyWithCapabilities:@{@"bundleId": @"com.facebook.awesome"}]);
+}
+
+- (void)testKeyDependsOnLaunchParameters
+{
+  NSDictionary *capabilities = @{
+    @"bundleId": @"com.facebook.awesome",
+    @"arguments": @[@"-a"],
+    @"environment": @{@"A": @"1", @"B": @"2"},
+  };
+  NSString *key = [FBApplicationPool keyWithCapabilities:capabilities];
+  XCTAssertNotEqualObjects(key, [FBApplicationPool keyWithCapabilities:@{@"bundleId": @"com.facebook.awesome"}]);
+  XCTAssertNotEqualObjects(key, [FBApplicationPool keyWithCapabilities:@{@"bundleId": @"com.facebook.other", @"arguments": @[@"-a"], @"environment": @{@"A": @"1", @"B": @"2"}}]);
+  XCTAssertNotEqualObjects(key, [FBApplicationPool keyWithCapabilities:@{@"bundleId": @"com.facebook.awesome", @"arguments": @[@"-a"], @"environment": @{@"A": @"1"}}]);
+}
+
+- (void)testCheckoutReturnsMatchingApplication
+{
+  FBApplicationDouble *application = [FBApplicationDouble new];
+  [self.pool checkinApplication:(id)application withKey:@"a"];
+  XCTAssertNil([self.pool checkoutApplicationWithKey:@"b"]);
+  XCTAssertEqual([self.pool checkoutApplicationWithKey:@"a"], (id)application);
+  XCTAssertNil([self.pool checkoutApplicationWithKey:@"a"]);
+  XCTAssertFalse(application.didTerminate);
+}
+
+- (void)testTerminatedApplicationIsNotReturned
+{
+  FBApplicationDouble *application = [FBApplicationDouble new];
+  [self.pool checkinApplication:(id)application withKey:@"a"];
+  [(id)application terminate];
+  XCTAssertNil([self.pool checkoutApplicationWithKey:@"a"]);
+  XCTAssertEqual(self.pool.count, 0);
+}
+
+- (void)testOldestApplicationIsTerminatedOverCapacity
+{
+  self.pool.capacity = 1;
+  FBApplicationDouble *firstApplication = [FBApplicationDouble new];
+  FBApplicationDouble *secondApplication = [FBApplicationDouble new];
+  [self.pool checkinApplication:(id)firstApplication withKey:@"a"];
+  [self.pool checkinApplication:(id)secondApplication withKey:@"b"];
+  XCTAssertTrue(firstApplication.didTerminate);
+  XCTAssertFalse(secondApplication.didTerminate);
+  XCTAssertEqual(self.pool.count, 1);
+}
+
+- (void)testDrain
+{
+  FBApplicationDouble *application = [FBApplicationDouble new];
+  [self.pool checkinApplication:(id)application withKey:@"a"];
+  [self.pool drain];
+  XCTAssertTrue(application.didTerminate);
+  XCTAssertEqual(self.pool.count, 0);
+}
+
+@end
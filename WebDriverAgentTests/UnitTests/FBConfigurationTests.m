@@ -46,4 +46,33 @@
   XCTAssertTrue([FBConfiguration verboseLoggingEnabled]);
 }
 
+- (void)testSettingsWithCapabilities
+{
+  NSDictionary *settings = [FBConfiguration settingsWithCapabilities:@{
+    @"shouldUseCompactResponses": @NO,
+    @"maxTypingFrequency": @30,
+    @"bundleId": @"com.facebook.awesome",
+  }];
+  XCTAssertEqualObjects(settings, (@{
+    @"shouldUseTestManagerForVisibilityDetection": @NO,
+    @"shouldUseCompactResponses": @NO,
+    @"maxTypingFrequency": @30,
+    @"shouldUseAdaptiveTypingFrequency": @NO,
+  }));
+}
+
+- (void)testSettingsOverrideGlobalValuesOnlyWithinBlock
+{
+  BOOL globalValue = [FBConfiguration shouldUseCompactResponses];
+  NSDictionary *settings = [FBConfiguration settingsWithCapabilities:@{@"shouldUseCompactResponses": @(!globalValue)}];
+  [FBConfiguration performWithSettings:settings block:^{
+    XCTAssertEqual([FBConfiguration shouldUseCompactResponses], !globalValue);
+    [FBConfiguration performWithSettings:nil block:^{
+      XCTAssertEqual([FBConfiguration shouldUseCompactResponses], globalValue);
+    }];
+    XCTAssertEqual([FBConfiguration shouldUseCompactResponses], !globalValue);
+  }];
+  XCTAssertEqual([FBConfiguration shouldUseCompactResponses], globalValue);
+}
+
 @end
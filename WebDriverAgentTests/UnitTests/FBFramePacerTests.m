@@ -0,0 +1,45 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <XCTest/XCTest.h>
+
+#import "FBFramePacer.h"
+
+@interface FBFramePacerTests : XCTestCase
+@end
+
+@implementation FBFramePacerTests
+
+- (void)testFirstFrameIsImmediate
+{
+  FBFramePacer *pacer = [[FBFramePacer alloc] initWithFramesPerSecond:10];
+  XCTAssertEqualWithAccuracy(pacer.frameInterval, 0.1, 0.0001);
+  XCTAssertEqual([pacer delayBeforeNextFrameAtTime:100], 0);
+}
+
+- (void)testConstantRate
+{
+  FBFramePacer *pacer = [[FBFramePacer alloc] initWithFramesPerSecond:10];
+  [pacer delayBeforeNextFrameAtTime:100];
+  XCTAssertEqualWithAccuracy([pacer delayBeforeNextFrameAtTime:100.02], 0.08, 0.0001);
+  XCTAssertEqualWithAccuracy([pacer delayBeforeNextFrameAtTime:100.15], 0.05, 0.0001);
+  XCTAssertEqual(pacer.skippedFramesCount, 0);
+}
+
+- (void)testSlowFramesAreSkipped
+{
+  FBFramePacer *pacer = [[FBFramePacer alloc] initWithFramesPerSecond:10];
+  [pacer delayBeforeNextFrameAtTime:100];
+  // The frame took 0.35 seconds, so slots 0.1 and 0.2 are missed and 0.3 is late
+  XCTAssertEqual([pacer delayBeforeNextFrameAtTime:100.35], 0);
+  XCTAssertEqual(pacer.skippedFramesCount, 2);
+  XCTAssertEqualWithAccuracy([pacer delayBeforeNextFrameAtTime:100.36], 0.04, 0.0001);
+}
+
+@end
@@ -0,0 +1,90 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <XCTest/XCTest.h>
+
+#import "FBHistogram.h"
+#import "FBRouteMetrics.h"
+
+@interface FBHistogramTests : XCTestCase
+@end
+
+@implementation FBHistogramTests
+
+- (void)testEmptyHistogram
+{
+  FBHistogram *histogram = [[FBHistogram alloc] initWithBucketBounds:@[@1, @10]];
+  XCTAssertEqual(histogram.count, 0);
+  XCTAssertEqual(histogram.sum, 0);
+  NSArray *expectedCounts = @[@0, @0];
+  XCTAssertEqualObjects(histogram.cumulativeBucketCounts, expectedCounts);
+}
+
+- (void)testRecordedValuesAreBucketed
+{
+  FBHistogram *histogram = [[FBHistogram alloc] initWithBucketBounds:@[@1, @10]];
+  [histogram recordValue:0.5];
+  [histogram recordValue:1];
+  [histogram recordValue:5];
+  [histogram recordValue:100];
+  XCTAssertEqual(histogram.count, 4);
+  XCTAssertEqualWithAccuracy(histogram.sum, 106.5, 0.0001);
+  NSArray *expectedCounts = @[@2, @3];
+  XCTAssertEqualObjects(histogram.cumulativeBucketCounts, expectedCounts);
+}
+
+- (void)testConcurrentRecording
+{
+  FBHistogram *histogram = [[FBHistogram alloc] initWithBucketBounds:@[@1]];
+  dispatch_apply(1000, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t iteration) {
+    [histogram recordValue:1];
+  });
+  XCTAssertEqual(histogram.count, 1000);
+  XCTAssertEqualWithAccuracy(histogram.sum, 1000, 0.0001);
+  XCTAssertEqualObjects(histogram.cumulativeBucketCounts, @[@1000]);
+}
+
+- (void)testRouteMetricsArePrometheusFormatted
+{
+  FBRouteMetrics *metrics = [FBRouteMetrics metricsForVerb:@"GET" path:@"/histogramTests/:uuid"];
+  XCTAssertEqual(metrics, [FBRouteMetrics metricsForVerb:@"GET" path:@"/histogramTests/:uuid"]);
+  XCTAssertNil([FBRouteMetrics metricsForVerb:nil path:@"/histogramTests/:uuid"]);
+  [metrics.handlerDuration recordValue:0.02];
+  NSString *text = [FBRouteMetrics prometheusText];
+  XCTAssertTrue([text containsString:@"# TYPE wda_request_handler_seconds histogram\n"]);
+  XCTAssertTrue([text containsString:@"wda_request_handler_seconds_bucket{method=\"GET\",route=\"/histogramTests/:uuid\",le=\"0.01\"} 0\n"]);
+  XCTAssertTrue([text containsString:@"wda_request_handler_seconds_bucket{method=\"GET\",route=\"/histogramTests/:uuid\",le=\"0.025\"} 1\n"]);
+  XCTAssertTrue([text containsString:@"wda_request_handler_seconds_bucket{method=\"GET\",route=\"/histogramTests/:uuid\",le=\"+Inf\"} 1\n"]);
+  XCTAssertTrue([text containsString:@"wda_request_handler_seconds_count{method=\"GET\",route=\"/histogramTests/:uuid\"} 1\n"]);
+}
+
+- (void)testUnlabelledPrometheusSamples
+{
+  FBHistogram *histogram = [[FBHistogram alloc] initWithBucketBounds:@[@1]];
+  [histogram recordValue:0.5];
+  [histogram recordValue:2];
+  NSString *expectedText = @"lag_bucket{le=\"1\"} 1\nlag_bucket{le=\"+Inf\"} 2\nlag_sum 2.500000\nlag_count 2\n";
+  XCTAssertEqualObjects([histogram prometheusSamplesWithName:@"lag" labels:nil], expectedText);
+}
+
+- (void)testRequestQueueGauges
+{
+  NSUInteger queuedCount = FBRouteMetricsQueuedRequestsCount();
+  NSUInteger inFlightCount = FBRouteMetricsInFlightRequestsCount();
+  FBRouteMetricsRequestQueued();
+  XCTAssertEqual(FBRouteMetricsQueuedRequestsCount(), queuedCount + 1);
+  FBRouteMetricsRequestStarted();
+  XCTAssertEqual(FBRouteMetricsQueuedRequestsCount(), queuedCount);
+  XCTAssertEqual(FBRouteMetricsInFlightRequestsCount(), inFlightCount + 1);
+  XCTAssertTrue([[FBRouteMetrics prometheusText] containsString:[NSString stringWithFormat:@"wda_requests_in_flight %lu\n", (unsigned long)inFlightCount + 1]]);
+  FBRouteMetricsRequestFinished();
+  XCTAssertEqual(FBRouteMetricsInFlightRequestsCount(), inFlightCount);
+}
+
+@end
@@ -0,0 +1,65 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <XCTest/XCTest.h>
+
+#import "FBImageUtils.h"
+
+@interface FBImageUtilsTests : XCTestCase
+@property (nonatomic) UIImage *image;
+@end
+
+@implementation FBImageUtilsTests
+
+- (void)setUp
+{
+  [super setUp];
+  UIGraphicsBeginImageContextWithOptions(CGSizeMake(40, 20), YES, 1.0);
+  [[UIColor redColor] setFill];
+  UIRectFill(CGRectMake(0, 0, 40, 20));
+  self.image = UIGraphicsGetImageFromCurrentImageContext();
+  UIGraphicsEndImageContext();
+}
+
+- (void)testMimeTypeDetection
+{
+  XCTAssertEqualObjects(FBImageMimeType(UIImagePNGRepresentation(self.image)), FBImageMimeTypePNG);
+  XCTAssertEqualObjects(FBImageMimeType(UIImageJPEGRepresentation(self.image, 0.9)), FBImageMimeTypeJPEG);
+  XCTAssertNil(FBImageMimeType([@"not an image" dataUsingEncoding:NSUTF8StringEncoding]));
+  XCTAssertNil(FBImageMimeType([NSData data]));
+}
+
+- (void)testSameFormatIsNotReencoded
+{
+  NSData *jpegData = UIImageJPEGRepresentation(self.image, 0.9);
+  XCTAssertEqual(FBConvertedImageData(jpegData, FBImageMimeTypeJPEG, 1.0, 1.0), jpegData);
+  NSData *pngData = UIImagePNGRepresentation(self.image);
+  XCTAssertEqual(FBToPngData(pngData), pngData);
+}
+
+- (void)testJpegToPngConversion
+{
+  NSData *pngData = FBToPngData(UIImageJPEGRepresentation(self.image, 0.9));
+  XCTAssertEqualObjects(FBImageMimeType(pngData), FBImageMimeTypePNG);
+  XCTAssertTrue(CGSizeEqualToSize([UIImage imageWithData:pngData].size, CGSizeMake(40, 20)));
+}
+
+- (void)testScaling
+{
+  NSData *scaledData = FBConvertedImageData(UIImagePNGRepresentation(self.image), FBImageMimeTypeJPEG, 0.5, 0.5);
+  XCTAssertEqualObjects(FBImageMimeType(scaledData), FBImageMimeTypeJPEG);
+  XCTAssertTrue(CGSizeEqualToSize([UIImage imageWithData:scaledData].size, CGSizeMake(20, 10)));
+}
+
+- (void)testInvalidDataConversion
+{
+  XCTAssertNil(FBToPngData([@"not an image" dataUsingEncoding:NSUTF8StringEncoding]));
+}
+
+@end
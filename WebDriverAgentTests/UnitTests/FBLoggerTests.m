@@ -0,0 +1,98 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <XCTest/XCTest.h>
+
+#import "FBLogger.h"
+
+@interface FBLoggerTests : XCTestCase
+@property (nonatomic, assign) FBLogLevel originalMinimumLevel;
+@end
+
+@implementation FBLoggerTests
+
+- (void)setUp
+{
+  [super setUp];
+  self.originalMinimumLevel = FBLoggerMinimumLevel;
+}
+
+- (void)tearDown
+{
+  [FBLogger setMinimumLevel:self.originalMinimumLevel];
+  [super tearDown];
+}
+
+- (void)testStructuredEntryIsRecorded
+{
+  [FBLogger setMinimumLevel:FBLogLevelInfo];
+  NSString *message = [NSUUID UUID].UUIDString;
+  FBLogStructured(FBLogLevelInfo, message, @{@"count": @3, @"object": [NSObject new]});
+  FBLogEntry *entry = [FBLogger recentEntries].lastObject;
+  XCTAssertEqualObjects(entry.message, message);
+  XCTAssertEqual(entry.level, FBLogLevelInfo);
+  NSDictionary *representation = entry.dictionaryRepresentation;
+  XCTAssertEqualObjects(representation[@"level"], @"info");
+  XCTAssertEqualObjects(representation[@"fields"][@"count"], @3);
+  XCTAssertTrue([NSJSONSerialization isValidJSONObject:representation]);
+}
+
+- (void)testDisabledLevelIsNotEvaluated
+{
+  [FBLogger setMinimumLevel:FBLogLevelInfo];
+  __block BOOL isEvaluated = NO;
+  NSString *(^message)(void) = ^NSString *{
+    isEvaluated = YES;
+    return @"Should not be logged";
+  };
+  FBLogStructured(FBLogLevelVerbose, message(), nil);
+  [FBLogger verboseLogFmt:@"%@", message()];
+  XCTAssertFalse(isEvaluated);
+  XCTAssertNotEqualObjects([FBLogger recentEntries].lastObject.message, @"Should not be logged");
+}
+
+- (void)testEntriesOrderFromConcurrentProducers
+{
+  [FBLogger setMinimumLevel:FBLogLevelInfo];
+  NSString *prefix = [NSUUID UUID].UUIDString;
+  dispatch_apply(4, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t producer) {
+    for (NSUInteger index = 0; index < 50; index++) {
+      [FBLogger logWithLevel:FBLogLevelInfo message:prefix fields:@{@"producer": @(producer), @"index": @(index)}];
+    }
+  });
+  NSMutableDictionary<NSNumber *, NSNumber *> *lastIndexes = [NSMutableDictionary dictionary];
+  NSUInteger count = 0;
+  for (FBLogEntry *entry in [FBLogger recentEntries]) {
+    if (![entry.message isEqualToString:prefix]) {
+      continue;
+    }
+    NSNumber *producer = entry.fields[@"producer"];
+    NSNumber *index = entry.fields[@"index"];
+    if (nil != lastIndexes[producer]) {
+      XCTAssertLessThan(lastIndexes[producer].unsignedIntegerValue, index.unsignedIntegerValue);
+    }
+    lastIndexes[producer] = index;
+    count++;
+  }
+  XCTAssertEqual(count, 200);
+}
+
+- (void)testRecentEntriesAreLimited
+{
+  [FBLogger setMinimumLevel:FBLogLevelInfo];
+  for (NSUInteger index = 0; index < 1100; index++) {
+    [FBLogger logFmt:@"Entry %lu", (unsigned long)index];
+  }
+  NSArray<FBLogEntry *> *entries = [FBLogger recentEntries];
+  XCTAssertEqual(entries.count, 1000);
+  XCTAssertEqualObjects(entries.lastObject.message, @"Entry 1099");
+  XCTAssertEqualObjects(entries.firstObject.message, @"Entry 100");
+}
+
+@end
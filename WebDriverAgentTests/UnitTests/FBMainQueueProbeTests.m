@@ -0,0 +1,49 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <XCTest/XCTest.h>
+
+#import "FBMainQueueProbe.h"
+
+@interface FBMainQueueProbeTests : XCTestCase
+@end
+
+@implementation FBMainQueueProbeTests
+
+- (void)testLatencyOfIdleMainQueue
+{
+  XCTestExpectation *expectation = [self expectationWithDescription:@"Main queue is probed"];
+  dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+    NSTimeInterval latency = [FBMainQueueProbe latencyWithTimeout:5];
+    XCTAssertGreaterThanOrEqual(latency, 0);
+    XCTAssertLessThan(latency, 5);
+    [expectation fulfill];
+  });
+  [self waitForExpectationsWithTimeout:10 handler:nil];
+}
+
+- (void)testLatencyOfBlockedMainQueue
+{
+  __block NSTimeInterval latency = 0;
+  dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
+  dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+    latency = [FBMainQueueProbe latencyWithTimeout:0.1];
+    dispatch_semaphore_signal(semaphore);
+  });
+  // The main thread is blocked, so the probe cannot be started in time
+  dispatch_semaphore_wait(semaphore, DISPATCH_TIME_FOREVER);
+  XCTAssertLessThan(latency, 0);
+}
+
+- (void)testLatencyOnMainThread
+{
+  XCTAssertEqual([FBMainQueueProbe latencyWithTimeout:1], 0);
+}
+
+@end
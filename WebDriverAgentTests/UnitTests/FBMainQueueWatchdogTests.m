@@ -0,0 +1,98 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <XCTest/XCTest.h>
+
+#import "FBHistogram.h"
+#import "FBMainQueueWatchdog.h"
+
+@interface FBMainQueueWatchdogTests : XCTestCase
+@property (nonatomic, strong) FBMainQueueWatchdog *watchdog;
+@end
+
+@implementation FBMainQueueWatchdogTests
+
+- (void)setUp
+{
+  [super setUp];
+  self.watchdog = [FBMainQueueWatchdog new];
+  self.watchdog.heartbeatInterval = 0.05;
+  self.watchdog.stallThreshold = 0.2;
+}
+
+- (void)tearDown
+{
+  [self.watchdog stop];
+  [super tearDown];
+}
+
+- (void)spinMainRunLoopFor:(NSTimeInterval)interval
+{
+  [[NSRunLoop mainRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:interval]];
+}
+
+- (void)testLagIsRecorded
+{
+  [self.watchdog start];
+  [self spinMainRunLoopFor:0.5];
+  XCTAssertGreaterThan(self.watchdog.lag.count, 0);
+  XCTAssertEqual(self.watchdog.stallsCount, 0);
+  XCTAssertLessThan(self.watchdog.currentLag, self.watchdog.stallThreshold);
+}
+
+- (void)testStallIsDetected
+{
+  [self.watchdog start];
+  [self spinMainRunLoopFor:0.2];
+  [NSThread sleepForTimeInterval:0.6];
+  [self spinMainRunLoopFor:0.2];
+
+  XCTAssertEqual(self.watchdog.stallsCount, 1);
+  FBMainQueueStall *stall = self.watchdog.recentStalls.firstObject;
+  XCTAssertNotNil(stall);
+  XCTAssertGreaterThanOrEqual(stall.duration, self.watchdog.stallThreshold);
+  XCTAssertGreaterThan(stall.stackSymbols.count, 0);
+  XCTAssertNotNil(stall.dictionaryRepresentation[@"stack"]);
+}
+
+- (void)testRecentStallsAreSnapshots
+{
+  [self.watchdog start];
+  [self spinMainRunLoopFor:0.2];
+  __block FBMainQueueStall *ongoingStall;
+  dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(0.4 * NSEC_PER_SEC)), dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0), ^{
+    ongoingStall = self.watchdog.recentStalls.firstObject;
+  });
+  [NSThread sleepForTimeInterval:0.8];
+  [self spinMainRunLoopFor:0.2];
+
+  FBMainQueueStall *finishedStall = self.watchdog.recentStalls.firstObject;
+  XCTAssertNotNil(ongoingStall);
+  XCTAssertNotNil(finishedStall);
+  XCTAssertNotEqual(ongoingStall, finishedStall);
+  XCTAssertEqual(ongoingStall.timestamp, finishedStall.timestamp);
+  XCTAssertLessThan(ongoingStall.duration, finishedStall.duration);
+}
+
+- (void)testPrometheusText
+{
+  NSString *text = [self.watchdog prometheusText];
+  XCTAssertTrue([text containsString:@"# TYPE wda_main_queue_lag_seconds histogram"]);
+  XCTAssertTrue([text containsString:@"wda_main_queue_stalls_total 0\n"]);
+}
+
+- (void)testRepeatedStartIsIgnored
+{
+  [self.watchdog start];
+  [self.watchdog start];
+  [self.watchdog stop];
+  [self.watchdog stop];
+}
+
+@end
@@ -122,6 +122,22 @@
   XCTAssertEqualObjects(route.path, @"/");
 }
 
+- (void)testRouteIsBoundToMainQueueByDefault
+{
+  FBRoute *route = [[FBRoute GET:@"/status"].withoutSession respondWithTarget:self action:@selector(dummyHandler:)];
+  XCTAssertFalse(route.isConcurrent);
+}
+
+- (void)testConcurrentRoute
+{
+  FBRoute *route = [[FBRoute GET:@"/status"].withoutSession.concurrent respondWithTarget:self action:@selector(dummyHandler:)];
+  XCTAssertTrue(route.isConcurrent);
+  route = [[FBRoute GET:@"/status"].concurrent respondWithBlock:^id<FBResponsePayload>(FBRouteRequest *request) {
+    return nil;
+  }];
+  XCTAssertTrue(route.isConcurrent);
+}
+
 + (id<FBResponsePayload>)dummyHandler:(FBRouteRequest *)request
 {
   return nil;
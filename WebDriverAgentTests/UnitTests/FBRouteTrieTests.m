@@ -0,0 +1,156 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <XCTest/XCTest.h>
+
+#import "FBCommandHandler.h"
+#import "FBRoute.h"
+#import "FBRouteTrie.h"
+#import "FBRuntimeUtils.h"
+#import "FBUnknownCommands.h"
+
+@interface FBRouteTrieTests : XCTestCase
+@property (nonatomic, strong) FBRouteTrie *trie;
+@end
+
+@implementation FBRouteTrieTests
+
+- (void)setUp
+{
+  [super setUp];
+  self.trie = [FBRouteTrie new];
+  [self.trie addValue:@"status" forVerb:@"GET" pathPattern:@"/status"];
+  [self.trie addValue:@"root" forVerb:@"GET" pathPattern:@"/"];
+  [self.trie addValue:@"element" forVerb:@"GET" pathPattern:@"/session/:sessionID/element/:uuid"];
+  [self.trie addValue:@"active" forVerb:@"GET" pathPattern:@"/session/:sessionID/element/active"];
+  [self.trie addValue:@"attribute" forVerb:@"GET" pathPattern:@"/session/:sessionID/element/:uuid/attribute/:name"];
+  [self.trie addValue:@"click" forVerb:@"POST" pathPattern:@"/session/:sessionID/element/:uuid/click"];
+  [self.trie addValue:@"unknown" forVerb:@"GET" pathPattern:@"/*"];
+}
+
+- (void)testLiteralMatch
+{
+  FBRouteMatch *match = [self.trie matchVerb:@"GET" path:@"/status"];
+  XCTAssertEqualObjects(match.value, @"status");
+  XCTAssertEqualObjects(match.parameters, @{});
+  XCTAssertEqualObjects([self.trie matchVerb:@"GET" path:@"/"].value, @"root");
+}
+
+- (void)testParametersCapture
+{
+  FBRouteMatch *match = [self.trie matchVerb:@"GET" path:@"/session/123/element/456/attribute/label"];
+  XCTAssertEqualObjects(match.value, @"attribute");
+  NSDictionary *expectedParameters = @{@"sessionID": @"123", @"uuid": @"456", @"name": @"label"};
+  XCTAssertEqualObjects(match.parameters, expectedParameters);
+}
+
+- (void)testLiteralTakesPrecedenceOverParameter
+{
+  XCTAssertEqualObjects([self.trie matchVerb:@"GET" path:@"/session/123/element/active"].value, @"active");
+  XCTAssertEqualObjects([self.trie matchVerb:@"GET" path:@"/session/123/element/456"].value, @"element");
+}
+
+- (void)testBacktrackingFromLiteral
+{
+  [self.trie addValue:@"activeName" forVerb:@"GET" pathPattern:@"/session/:sessionID/element/:uuid/name"];
+  FBRouteMatch *match = [self.trie matchVerb:@"GET" path:@"/session/123/element/active/name"];
+  XCTAssertEqualObjects(match.value, @"activeName");
+  XCTAssertEqualObjects(match.parameters[@"uuid"], @"active");
+}
+
+- (void)testVerbsAreSeparated
+{
+  XCTAssertEqualObjects([self.trie matchVerb:@"POST" path:@"/session/123/element/456/click"].value, @"click");
+  XCTAssertNil([self.trie matchVerb:@"POST" path:@"/status"]);
+  XCTAssertNil([self.trie matchVerb:@"PUT" path:@"/status"]);
+  NSArray *expectedVerbs = @[@"GET", @"POST"];
+  XCTAssertEqualObjects(self.trie.verbs, expectedVerbs);
+}
+
+- (void)testWildcardFallback
+{
+  FBRouteMatch *match = [self.trie matchVerb:@"GET" path:@"/session/123/unknown/command"];
+  XCTAssertEqualObjects(match.value, @"unknown");
+  XCTAssertEqualObjects(match.parameters[@"wildcards"], @[@"session/123/unknown/command"]);
+  XCTAssertEqualObjects([self.trie matchVerb:@"GET" path:@"/session/123/element/456/attribute"].value, @"unknown");
+}
+
+- (void)testFirstRegisteredValueWins
+{
+  [self.trie addValue:@"anotherStatus" forVerb:@"GET" pathPattern:@"/status"];
+  XCTAssertEqualObjects([self.trie matchVerb:@"GET" path:@"/status"].value, @"status");
+}
+
+- (void)testEmptySegmentsAreIgnored
+{
+  XCTAssertEqualObjects([self.trie matchVerb:@"GET" path:@"//status/"].value, @"status");
+}
+
+#pragma mark - Real routes
+
+- (NSArray<FBRoute *> *)registeredRoutes
+{
+  NSMutableArray<FBRoute *> *routes = [NSMutableArray array];
+  for (Class<FBCommandHandler> handlerClass in FBClassesThatConformsToProtocol(@protocol(FBCommandHandler))) {
+    if (handlerClass == FBUnknownCommands.class) {
+      continue;
+    }
+    [routes addObjectsFromArray:[handlerClass routes]];
+  }
+  [routes addObjectsFromArray:[FBUnknownCommands routes]];
+  return routes.copy;
+}
+
+- (NSString *)requestPathForPattern:(NSString *)pattern
+{
+  NSMutableArray<NSString *> *segments = [NSMutableArray array];
+  for (NSString *segment in [pattern componentsSeparatedByString:@"/"]) {
+    if ([segment hasPrefix:@":"]) {
+      [segments addObject:@"ABC-123"];
+    } else if ([segment isEqualToString:@"*"]) {
+      [segments addObject:@"unknown/command"];
+    } else {
+      [segments addObject:segment];
+    }
+  }
+  return [segments componentsJoinedByString:@"/"];
+}
+
+- (void)testAllRegisteredRoutesAreMatched
+{
+  NSArray<FBRoute *> *routes = self.registeredRoutes;
+  FBRouteTrie *trie = [FBRouteTrie new];
+  for (FBRoute *route in routes) {
+    [trie addValue:route forVerb:route.verb pathPattern:route.path];
+  }
+  for (FBRoute *route in routes) {
+    FBRouteMatch *match = [trie matchVerb:route.verb path:[self requestPathForPattern:route.path]];
+    XCTAssertEqualObjects([match.value path], route.path);
+  }
+}
+
+- (void)testRouteMatchingPerformance
+{
+  NSArray<FBRoute *> *routes = self.registeredRoutes;
+  FBRouteTrie *trie = [FBRouteTrie new];
+  NSMutableArray<NSArray<NSString *> *> *requests = [NSMutableArray array];
+  for (FBRoute *route in routes) {
+    [trie addValue:route forVerb:route.verb pathPattern:route.path];
+    [requests addObject:@[route.verb, [self requestPathForPattern:route.path]]];
+  }
+  [self measureBlock:^{
+    for (NSUInteger iteration = 0; iteration < 100; iteration++) {
+      for (NSArray<NSString *> *request in requests) {
+        [trie matchVerb:request[0] path:request[1]];
+      }
+    }
+  }];
+}
+
+@end
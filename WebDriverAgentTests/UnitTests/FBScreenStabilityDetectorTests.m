@@ -0,0 +1,87 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <XCTest/XCTest.h>
+
+#import "FBScreenStabilityDetector.h"
+
+@interface FBScreenStabilityDetectorTests : XCTestCase
+@end
+
+@implementation FBScreenStabilityDetectorTests
+
+- (NSData *)imageWithMarkerAtOffset:(CGFloat)offset
+{
+  UIGraphicsBeginImageContextWithOptions(CGSizeMake(200, 100), YES, 1.0);
+  [[UIColor whiteColor] setFill];
+  UIRectFill(CGRectMake(0, 0, 200, 100));
+  [[UIColor blackColor] setFill];
+  UIRectFill(CGRectMake(offset, 10, 20, 20));
+  NSData *result = UIImagePNGRepresentation(UIGraphicsGetImageFromCurrentImageContext());
+  UIGraphicsEndImageContext();
+  return result;
+}
+
+- (void)testStableScreen
+{
+  NSData *imageData = [self imageWithMarkerAtOffset:0];
+  FBScreenStabilityDetector *detector = [[FBScreenStabilityDetector alloc] initWithFrameSource:^NSData *{
+    return imageData;
+  }];
+  detector.samplingInterval = 0;
+  NSError *error;
+  XCTAssertTrue([detector waitUntilStableWithTimeout:1.0 error:&error]);
+  XCTAssertNil(error);
+  XCTAssertEqual(detector.sampledFramesCount, 3);
+}
+
+- (void)testScreenBecomesStable
+{
+  NSArray<NSData *> *frames = @[
+    [self imageWithMarkerAtOffset:0],
+    [self imageWithMarkerAtOffset:60],
+    [self imageWithMarkerAtOffset:120],
+    [self imageWithMarkerAtOffset:120],
+  ];
+  __block NSUInteger frameIndex = 0;
+  FBScreenStabilityDetector *detector = [[FBScreenStabilityDetector alloc] initWithFrameSource:^NSData *{
+    NSData *frame = frames[MIN(frameIndex, frames.count - 1)];
+    frameIndex++;
+    return frame;
+  }];
+  detector.samplingInterval = 0;
+  detector.stableFramesCount = 2;
+  XCTAssertTrue([detector waitUntilStableWithTimeout:1.0 error:nil]);
+  XCTAssertEqual(detector.sampledFramesCount, 4);
+  XCTAssertEqual(detector.lastChangedTilesCount, 0);
+}
+
+- (void)testChangingScreenTimesOut
+{
+  __block CGFloat offset = 0;
+  FBScreenStabilityDetector *detector = [[FBScreenStabilityDetector alloc] initWithFrameSource:^NSData *{
+    offset = offset > 150 ? 0 : offset + 30;
+    return [self imageWithMarkerAtOffset:offset];
+  }];
+  detector.samplingInterval = 0.05;
+  NSError *error;
+  XCTAssertFalse([detector waitUntilStableWithTimeout:0.3 error:&error]);
+  XCTAssertNotNil(error);
+  XCTAssertGreaterThan(detector.lastChangedTilesCount, 0);
+}
+
+- (void)testTileHashesOfInvalidImage
+{
+  FBScreenStabilityDetector *detector = [[FBScreenStabilityDetector alloc] initWithFrameSource:^NSData *{
+    return nil;
+  }];
+  XCTAssertNil([detector tileHashesOfImageData:[@"not an image" dataUsingEncoding:NSUTF8StringEncoding]]);
+}
+
+@end
@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <XCTest/XCTest.h>
+
+#import "FBImageUtils.h"
+#import "FBScreenStream.h"
+
+@interface FBScreenStreamTests : XCTestCase
+@property (nonatomic) NSData *imageData;
+@property (atomic) NSUInteger capturedFramesCount;
+@end
+
+@implementation FBScreenStreamTests
+
+- (void)setUp
+{
+  [super setUp];
+  UIGraphicsBeginImageContextWithOptions(CGSizeMake(40, 20), YES, 1.0);
+  [[UIColor blueColor] setFill];
+  UIRectFill(CGRectMake(0, 0, 40, 20));
+  self.imageData = UIImagePNGRepresentation(UIGraphicsGetImageFromCurrentImageContext());
+  UIGraphicsEndImageContext();
+  self.capturedFramesCount = 0;
+}
+
+- (FBScreenStream *)streamWithFramesPerSecond:(NSUInteger)framesPerSecond
+{
+  return [[FBScreenStream alloc] initWithFrameSource:^NSData *{
+    self.capturedFramesCount++;
+    return self.imageData;
+  } framesPerSecond:framesPerSecond scalingFactor:0.5 compressionQuality:0.5];
+}
+
+- (NSData *)waitForFrameOfStream:(FBScreenStream *)stream
+{
+  NSDate *deadline = [NSDate dateWithTimeIntervalSinceNow:2.0];
+  NSData *frame;
+  while (nil == (frame = [stream nextFrameData]) && [deadline timeIntervalSinceNow] > 0) {
+    [NSThread sleepForTimeInterval:0.01];
+  }
+  return frame;
+}
+
+- (void)testMultipartFrame
+{
+  NSData *jpegData = [@"jpeg" dataUsingEncoding:NSUTF8StringEncoding];
+  NSData *frame = [FBScreenStream multipartFrameWithJpegData:jpegData boundary:@"frame"];
+  NSString *frameString = [[NSString alloc] initWithData:frame encoding:NSUTF8StringEncoding];
+  XCTAssertEqualObjects(frameString, @"--frame\r\nContent-Type: image/jpeg\r\nContent-Length: 4\r\n\r\njpeg\r\n");
+}
+
+- (void)testFramesAreEncodedAsJpeg
+{
+  FBScreenStream *stream = [self streamWithFramesPerSecond:30];
+  [stream start];
+  NSData *frame = [self waitForFrameOfStream:stream];
+  [stream stop];
+  XCTAssertNotNil(frame);
+  NSString *header = [NSString stringWithFormat:@"--%@\r\nContent-Type: image/jpeg\r\n", stream.boundary];
+  NSData *headerData = [header dataUsingEncoding:NSUTF8StringEncoding];
+  XCTAssertEqualObjects([frame subdataWithRange:NSMakeRange(0, headerData.length)], headerData);
+  NSRange bodyStart = [frame rangeOfData:[@"\r\n\r\n" dataUsingEncoding:NSUTF8StringEncoding] options:0 range:NSMakeRange(0, frame.length)];
+  NSData *jpegData = [frame subdataWithRange:NSMakeRange(NSMaxRange(bodyStart), frame.length - NSMaxRange(bodyStart) - 2)];
+  XCTAssertEqualObjects(FBImageMimeType(jpegData), FBImageMimeTypeJPEG);
+  XCTAssertTrue(CGSizeEqualToSize([UIImage imageWithData:jpegData].size, CGSizeMake(20, 10)));
+}
+
+- (void)testFramesAreSkippedForSlowClient
+{
+  FBScreenStream *stream = [self streamWithFramesPerSecond:50];
+  [stream start];
+  XCTAssertNotNil([self waitForFrameOfStream:stream]);
+  // Do not consume frames for a while
+  [NSThread sleepForTimeInterval:0.5];
+  NSUInteger capturedFramesCount = self.capturedFramesCount;
+  [stream stop];
+  XCTAssertGreaterThan(stream.skippedFramesCount, 10);
+  XCTAssertLessThanOrEqual(capturedFramesCount, 3);
+}
+
+@end
@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <XCTest/XCTest.h>
+
+#import "FBImageUtils.h"
+#import "FBScreenshotDiffer.h"
+
+@interface FBScreenshotDifferTests : XCTestCase
+@property (nonatomic) FBScreenshotDiffer *differ;
+@end
+
+@implementation FBScreenshotDifferTests
+
+- (void)setUp
+{
+  [super setUp];
+  self.differ = [[FBScreenshotDiffer alloc] initWithTileSize:32];
+}
+
+- (NSData *)imageWithSize:(CGSize)size changedRect:(CGRect)changedRect
+{
+  UIGraphicsBeginImageContextWithOptions(size, YES, 1.0);
+  [[UIColor whiteColor] setFill];
+  UIRectFill(CGRectMake(0, 0, size.width, size.height));
+  [[UIColor blackColor] setFill];
+  UIRectFill(changedRect);
+  NSData *result = UIImagePNGRepresentation(UIGraphicsGetImageFromCurrentImageContext());
+  UIGraphicsEndImageContext();
+  return result;
+}
+
+- (FBScreenshotDelta *)deltaWithImageData:(NSData *)imageData baseSequenceNumber:(NSUInteger)baseSequenceNumber
+{
+  NSError *error;
+  FBScreenshotDelta *delta = [self.differ deltaWithImageData:imageData baseSequenceNumber:baseSequenceNumber mimeType:FBImageMimeTypePNG compressionQuality:1.0 error:&error];
+  XCTAssertNil(error);
+  return delta;
+}
+
+- (void)testFirstScreenshotIsFull
+{
+  FBScreenshotDelta *delta = [self deltaWithImageData:[self imageWithSize:CGSizeMake(100, 70) changedRect:CGRectZero] baseSequenceNumber:0];
+  XCTAssertEqual(delta.sequenceNumber, 1);
+  XCTAssertEqual(delta.baseSequenceNumber, 0);
+  XCTAssertTrue(CGSizeEqualToSize(delta.size, CGSizeMake(100, 70)));
+  XCTAssertEqual(delta.tiles.count, 1);
+  XCTAssertTrue(CGRectEqualToRect(delta.tiles.firstObject.rect, CGRectMake(0, 0, 100, 70)));
+  XCTAssertTrue(CGSizeEqualToSize([UIImage imageWithData:delta.tiles.firstObject.imageData].size, CGSizeMake(100, 70)));
+}
+
+- (void)testUnchangedScreenshotHasNoTiles
+{
+  NSData *imageData = [self imageWithSize:CGSizeMake(100, 70) changedRect:CGRectZero];
+  [self deltaWithImageData:imageData baseSequenceNumber:0];
+  FBScreenshotDelta *delta = [self deltaWithImageData:imageData baseSequenceNumber:1];
+  XCTAssertEqual(delta.sequenceNumber, 2);
+  XCTAssertEqual(delta.baseSequenceNumber, 1);
+  XCTAssertEqual(delta.tiles.count, 0);
+}
+
+- (void)testChangedTilesAreReturned
+{
+  [self deltaWithImageData:[self imageWithSize:CGSizeMake(100, 70) changedRect:CGRectZero] baseSequenceNumber:0];
+  FBScreenshotDelta *delta = [self deltaWithImageData:[self imageWithSize:CGSizeMake(100, 70) changedRect:CGRectMake(40, 10, 30, 40)] baseSequenceNumber:1];
+  XCTAssertEqual(delta.tiles.count, 1);
+  XCTAssertTrue(CGRectEqualToRect(delta.tiles.firstObject.rect, CGRectMake(32, 0, 64, 64)));
+  XCTAssertTrue(CGSizeEqualToSize([UIImage imageWithData:delta.tiles.firstObject.imageData].size, CGSizeMake(64, 64)));
+}
+
+- (void)testMismatchingBaseReturnsFullScreenshot
+{
+  [self deltaWithImageData:[self imageWithSize:CGSizeMake(100, 70) changedRect:CGRectZero] baseSequenceNumber:0];
+  FBScreenshotDelta *delta = [self deltaWithImageData:[self imageWithSize:CGSizeMake(100, 70) changedRect:CGRectZero] baseSequenceNumber:5];
+  XCTAssertEqual(delta.baseSequenceNumber, 0);
+  XCTAssertEqual(delta.tiles.count, 1);
+  XCTAssertTrue(CGRectEqualToRect(delta.tiles.firstObject.rect, CGRectMake(0, 0, 100, 70)));
+}
+
+- (void)testDirtyRectsMerging
+{
+  size_t width = 96;
+  size_t height = 96;
+  NSMutableData *previousPixels = [NSMutableData dataWithLength:width * height * 4];
+  NSMutableData *pixels = previousPixels.mutableCopy;
+  uint8_t *bytes = pixels.mutableBytes;
+  // Change the pixels of tiles (0, 0), (1, 0), (0, 1), (1, 1) and (2, 2)
+  bytes[(0 * width + 0) * 4] = 1;
+  bytes[(0 * width + 40) * 4] = 1;
+  bytes[(40 * width + 0) * 4] = 1;
+  bytes[(63 * width + 63) * 4] = 1;
+  bytes[(95 * width + 95) * 4] = 1;
+  NSArray<NSValue *> *rects = [FBScreenshotDiffer dirtyRectsBetweenPixels:pixels previousPixels:previousPixels width:width height:height tileSize:32];
+  XCTAssertEqual(rects.count, 2);
+  XCTAssertTrue(CGRectEqualToRect(rects[0].CGRectValue, CGRectMake(0, 0, 64, 64)));
+  XCTAssertTrue(CGRectEqualToRect(rects[1].CGRectValue, CGRectMake(64, 64, 32, 32)));
+}
+
+@end
@@ -10,6 +10,8 @@
 #import <XCTest/XCTest.h>
 
 #import "FBApplicationDouble.h"
+#import "FBApplicationPool.h"
+#import "FBConfiguration.h"
 #import "FBSession.h"
 
 @interface FBSessionTests : XCTestCase
@@ -48,13 +50,68 @@
   XCTAssertEqual(self.session, [FBSession activeSession]);
 }
 
-- (void)testAfterKillingSessionShouldCreateNewOne
+- (void)testAfterKillingSessionThereIsNoActiveSession
 {
-  NSString *sessionIdentifier = self.session.identifier;
   [self.session kill];
   XCTAssertTrue(((FBApplicationDouble *)self.testedApplication).didTerminate);
-  XCTAssertNotNil([FBSession activeSession]);
-  XCTAssertNotEqual([FBSession activeSession].identifier, sessionIdentifier);
+  NSUInteger sessionsCount = [FBSession allSessions].count;
+  XCTAssertNil([FBSession activeSession]);
+  // Asking for the active session must not register a session nobody has created
+  XCTAssertEqual([FBSession allSessions].count, sessionsCount);
+  XCTAssertFalse([[FBSession allSessions] containsObject:self.session]);
+}
+
+- (void)testSessionsOfDifferentApplicationsCoexist
+{
+  FBApplicationDouble *otherApplication = FBApplicationDouble.new;
+  otherApplication.bundleID = @"com.facebook.other";
+  FBSession *otherSession = [FBSession sessionWithApplication:(id)otherApplication];
+  XCTAssertFalse(((FBApplicationDouble *)self.testedApplication).didTerminate);
+  XCTAssertEqual(self.session, [FBSession sessionWithIdentifier:self.session.identifier]);
+  XCTAssertEqual(otherSession, [FBSession sessionWithIdentifier:otherSession.identifier]);
+  XCTAssertEqual(otherSession, [FBSession activeSession]);
+  XCTAssertNotEqual(self.session.elementCache, otherSession.elementCache);
+
+  [otherSession kill];
+  XCTAssertNil([FBSession sessionWithIdentifier:otherSession.identifier]);
+  XCTAssertEqual(self.session, [FBSession sessionWithIdentifier:self.session.identifier]);
+}
+
+- (void)testNewSessionOfSameApplicationReplacesPreviousOne
+{
+  FBSession *newSession = [FBSession sessionWithApplication:(id)FBApplicationDouble.new];
+  XCTAssertNil([FBSession sessionWithIdentifier:self.session.identifier]);
+  XCTAssertEqual(newSession, [FBSession sessionWithIdentifier:newSession.identifier]);
+}
+
+- (void)testPerformAsCurrentSession
+{
+  FBApplicationDouble *otherApplication = FBApplicationDouble.new;
+  otherApplication.bundleID = @"com.facebook.other";
+  NSDictionary *settings = [FBConfiguration settingsWithCapabilities:@{@"maxTypingFrequency": @10}];
+  FBSession *otherSession = [FBSession sessionWithApplication:(id)otherApplication settings:settings];
+  NSUInteger defaultTypingFrequency = [FBConfiguration maxTypingFrequency];
+
+  XCTAssertNil([FBSession currentSession]);
+  [otherSession performAsCurrentSession:^{
+    XCTAssertEqual(otherSession, [FBSession currentSession]);
+    XCTAssertEqual([FBConfiguration maxTypingFrequency], 10);
+  }];
+  [self.session performAsCurrentSession:^{
+    XCTAssertEqual(self.session, [FBSession currentSession]);
+    XCTAssertEqual([FBConfiguration maxTypingFrequency], defaultTypingFrequency);
+  }];
+  XCTAssertNil([FBSession currentSession]);
+  XCTAssertEqual([FBConfiguration maxTypingFrequency], defaultTypingFrequency);
+  [otherSession kill];
+}
+
+- (void)testKillingSessionWithPoolKeyKeepsApplicationRunning
+{
+  self.session.applicationPoolKey = @"FBSessionTests";
+  [self.session kill];
+  XCTAssertFalse(((FBApplicationDouble *)self.testedApplication).didTerminate);
+  XCTAssertEqual([[FBApplicationPool sharedPool] checkoutApplicationWithKey:@"FBSessionTests"], self.testedApplication);
 }
 
 @end
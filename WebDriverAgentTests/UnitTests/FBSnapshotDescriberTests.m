@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <XCTest/XCTest.h>
+
+#import "FBSnapshotDescriber.h"
+#import "XCUIElementDouble.h"
+
+@interface FBSnapshotDescriberTests : XCTestCase
+@property (nonatomic, strong) XCUIElementDouble *root;
+@end
+
+@implementation FBSnapshotDescriberTests
+
+- (void)setUp
+{
+  [super setUp];
+  XCUIElementDouble *button = [XCUIElementDouble new];
+  button.elementType = XCUIElementTypeButton;
+  button.wdFrame = CGRectMake(10, 20, 30, 40);
+  button.wdName = @"ok";
+  button.wdLabel = @"OK";
+  button.wdValue = nil;
+  button.wdEnabled = NO;
+
+  XCUIElementDouble *window = [XCUIElementDouble new];
+  window.elementType = XCUIElementTypeWindow;
+  window.wdFrame = CGRectMake(0, 0, 320, 480);
+  window.wdName = nil;
+  window.wdLabel = nil;
+  window.wdValue = @"first\nsecond";
+  window.children = @[button];
+
+  self.root = [XCUIElementDouble new];
+  self.root.elementType = XCUIElementTypeApplication;
+  self.root.wdFrame = CGRectMake(0, 0, 320, 480);
+  self.root.wdName = @"App";
+  self.root.wdLabel = @"App";
+  self.root.wdValue = nil;
+  self.root.children = @[window];
+}
+
+- (void)testFullTreeDescription
+{
+  NSString *description = [FBSnapshotDescriber descriptionOfSnapshot:(XCElementSnapshot *)self.root maxDepth:NSUIntegerMax];
+  NSString *expected =
+  @"Application, {{0.0, 0.0}, {320.0, 480.0}}, name: 'App', label: 'App'\n"
+  @"  Window, {{0.0, 0.0}, {320.0, 480.0}}, value: 'first\\nsecond'\n"
+  @"    Button, {{10.0, 20.0}, {30.0, 40.0}}, name: 'ok', label: 'OK', Disabled";
+  XCTAssertEqualObjects(description, expected);
+}
+
+- (void)testLimitedDepthDescription
+{
+  NSString *description = [FBSnapshotDescriber descriptionOfSnapshot:(XCElementSnapshot *)self.root maxDepth:1];
+  NSString *expected =
+  @"Application, {{0.0, 0.0}, {320.0, 480.0}}, name: 'App', label: 'App'\n"
+  @"  Window, {{0.0, 0.0}, {320.0, 480.0}}, value: 'first\\nsecond', 1 children not shown";
+  XCTAssertEqualObjects(description, expected);
+}
+
+- (void)testRootOnlyDescription
+{
+  NSString *description = [FBSnapshotDescriber descriptionOfSnapshot:(XCElementSnapshot *)self.root maxDepth:0];
+  XCTAssertEqualObjects(description, @"Application, {{0.0, 0.0}, {320.0, 480.0}}, name: 'App', label: 'App', 1 children not shown");
+}
+
+@end
@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <XCTest/XCTest.h>
+
+#import "FBSourceRevisionStore.h"
+
+@interface FBSourceRevisionStoreTests : XCTestCase
+@end
+
+@implementation FBSourceRevisionStoreTests
+
+- (NSDictionary *)treeWithButtonLabel:(NSString *)label
+{
+  return @{
+    @"type": @"Application",
+    @"children": @[
+      @{@"type": @"Window", @"children": @[
+        @{@"type": @"Button", @"label": label},
+        @{@"type": @"StaticText", @"label": @"Title"},
+      ]},
+      @{@"type": @"Window"},
+    ],
+  };
+}
+
+- (void)testIdenticalTreesHaveNoPatches
+{
+  NSDictionary *tree = [self treeWithButtonLabel:@"OK"];
+  XCTAssertEqualObjects([FBSourceRevisionStore patchesFromTree:tree toTree:tree], @[]);
+}
+
+- (void)testChangedAttributeReplacesNode
+{
+  NSArray *patches = [FBSourceRevisionStore patchesFromTree:[self treeWithButtonLabel:@"OK"] toTree:[self treeWithButtonLabel:@"Cancel"]];
+  XCTAssertEqual(patches.count, 1);
+  NSArray *expectedPath = @[@0, @0];
+  XCTAssertEqualObjects(patches.firstObject[@"path"], expectedPath);
+  XCTAssertEqualObjects(patches.firstObject[@"node"][@"label"], @"Cancel");
+}
+
+- (void)testChangedChildrenCountReplacesSubtree
+{
+  NSDictionary *oldTree = [self treeWithButtonLabel:@"OK"];
+  NSDictionary *newTree = @{
+    @"type": @"Application",
+    @"children": @[oldTree[@"children"][0]],
+  };
+  NSArray *patches = [FBSourceRevisionStore patchesFromTree:oldTree toTree:newTree];
+  XCTAssertEqual(patches.count, 1);
+  XCTAssertEqualObjects(patches.firstObject[@"path"], @[]);
+  XCTAssertEqualObjects(patches.firstObject[@"node"], newTree);
+}
+
+- (void)testRevisions
+{
+  FBSourceRevisionStore *store = [[FBSourceRevisionStore alloc] initWithCapacity:1];
+  NSDictionary *changes = [store changesOfTree:[self treeWithButtonLabel:@"OK"] sinceRevision:nil];
+  XCTAssertEqualObjects(changes[@"base"], [NSNull null]);
+  XCTAssertNotNil(changes[@"tree"]);
+  NSString *revision = changes[@"revision"];
+
+  changes = [store changesOfTree:[self treeWithButtonLabel:@"OK"] sinceRevision:revision];
+  XCTAssertEqualObjects(changes[@"revision"], revision);
+  XCTAssertEqualObjects(changes[@"patches"], @[]);
+
+  changes = [store changesOfTree:[self treeWithButtonLabel:@"Cancel"] sinceRevision:revision];
+  XCTAssertEqualObjects(changes[@"base"], revision);
+  XCTAssertEqual([changes[@"patches"] count], 1);
+  XCTAssertNotEqualObjects(changes[@"revision"], revision);
+
+  // The first revision has been evicted, since the capacity is 1
+  changes = [store changesOfTree:[self treeWithButtonLabel:@"Cancel"] sinceRevision:revision];
+  XCTAssertEqualObjects(changes[@"base"], [NSNull null]);
+  XCTAssertNotNil(changes[@"tree"]);
+}
+
+@end
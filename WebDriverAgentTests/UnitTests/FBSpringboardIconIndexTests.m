@@ -0,0 +1,52 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <XCTest/XCTest.h>
+
+#import "FBSpringboardIconIndex.h"
+
+@interface FBSpringboardIconIndexTests : XCTestCase
+@end
+
+@implementation FBSpringboardIconIndexTests
+
+- (void)testPagesAreRelativeToVisiblePage
+{
+  FBSpringboardIconIndex *index = [[FBSpringboardIconIndex alloc] initWithIcons:@[
+    [FBSpringboardIcon iconWithIdentifier:@"Safari" label:@"Safari" frame:CGRectMake(20, 100, 60, 60)],
+    [FBSpringboardIcon iconWithIdentifier:@"Maps" label:@"Maps" frame:CGRectMake(340, 100, 60, 60)],
+    [FBSpringboardIcon iconWithIdentifier:@"Notes" label:@"Notes" frame:CGRectMake(980, 100, 60, 60)],
+    [FBSpringboardIcon iconWithIdentifier:@"Spotlight" label:@"Spotlight" frame:CGRectMake(-300, 100, 60, 60)],
+  ] pageWidth:320];
+  XCTAssertEqual(index.count, 4);
+  XCTAssertEqual([index iconForApplicationWithIdentifier:@"Safari"].page, 0);
+  XCTAssertEqual([index iconForApplicationWithIdentifier:@"Maps"].page, 1);
+  XCTAssertEqual([index iconForApplicationWithIdentifier:@"Notes"].page, 3);
+  XCTAssertEqual([index iconForApplicationWithIdentifier:@"Spotlight"].page, -1);
+}
+
+- (void)testIconsAreMatchedByIdentifierThenByLabel
+{
+  FBSpringboardIcon *identifiedIcon = [FBSpringboardIcon iconWithIdentifier:@"Calendar" label:@"Other" frame:CGRectMake(20, 100, 60, 60)];
+  FBSpringboardIcon *labeledIcon = [FBSpringboardIcon iconWithIdentifier:nil label:@"Calendar" frame:CGRectMake(100, 100, 60, 60)];
+  FBSpringboardIconIndex *index = [[FBSpringboardIconIndex alloc] initWithIcons:@[identifiedIcon, labeledIcon] pageWidth:320];
+  XCTAssertEqual([index iconForApplicationWithIdentifier:@"Calendar"], identifiedIcon);
+  XCTAssertEqual([index iconForApplicationWithIdentifier:@"Other"], identifiedIcon);
+  XCTAssertNil([index iconForApplicationWithIdentifier:@"Missing"]);
+}
+
+- (void)testMostRecentlyInstalledApplicationIsSelected
+{
+  FBSpringboardIcon *olderIcon = [FBSpringboardIcon iconWithIdentifier:@"App" label:@"App" frame:CGRectMake(20, 100, 60, 60)];
+  FBSpringboardIcon *newerIcon = [FBSpringboardIcon iconWithIdentifier:@"App" label:@"App" frame:CGRectMake(340, 100, 60, 60)];
+  FBSpringboardIconIndex *index = [[FBSpringboardIconIndex alloc] initWithIcons:@[olderIcon, newerIcon] pageWidth:320];
+  XCTAssertEqual([index iconForApplicationWithIdentifier:@"App"], newerIcon);
+}
+
+@end
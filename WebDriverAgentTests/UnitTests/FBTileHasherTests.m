@@ -0,0 +1,73 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <XCTest/XCTest.h>
+
+#import "FBTileHasher.h"
+
+@interface FBTileHasherTests : XCTestCase
+@end
+
+@implementation FBTileHasherTests
+
+- (void)testTilesCount
+{
+  XCTAssertEqual(FBTilesCount(32, 32, 16), 4);
+  XCTAssertEqual(FBTilesCount(33, 17, 16), 6);
+  XCTAssertEqual(FBTilesCount(0, 10, 16), 0);
+}
+
+- (void)testOnlyChangedTileHashDiffers
+{
+  size_t width = 40;
+  size_t height = 20;
+  size_t bytesPerRow = width * 4;
+  NSMutableData *pixels = [NSMutableData dataWithLength:bytesPerRow * height];
+  size_t tilesCount = FBTilesCount(width, height, 16);
+  XCTAssertEqual(tilesCount, 6);
+  uint64_t hashes[6];
+  uint64_t changedHashes[6];
+  FBComputeTileHashes(pixels.bytes, width, height, bytesPerRow, 16, hashes);
+
+  // Change a single pixel in the last tile, which is narrower and shorter than the others
+  ((uint8_t *)pixels.mutableBytes)[19 * bytesPerRow + 39 * 4] = 0xFF;
+  FBComputeTileHashes(pixels.bytes, width, height, bytesPerRow, 16, changedHashes);
+  XCTAssertEqual(FBChangedTilesCount(hashes, changedHashes, tilesCount), 1);
+  XCTAssertNotEqual(hashes[5], changedHashes[5]);
+}
+
+- (void)testPixelsOrderMatters
+{
+  size_t width = 16;
+  uint32_t pixels[16] = {0};
+  uint64_t hash;
+  uint64_t swappedHash;
+  pixels[0] = 1;
+  FBComputeTileHashes((const uint8_t *)pixels, width, 1, sizeof(pixels), 16, &hash);
+  pixels[0] = 0;
+  pixels[8] = 1;
+  FBComputeTileHashes((const uint8_t *)pixels, width, 1, sizeof(pixels), 16, &swappedHash);
+  XCTAssertNotEqual(hash, swappedHash);
+}
+
+- (void)testHashingPerformance
+{
+  // Full resolution screenshot of a large phone
+  size_t width = 1242;
+  size_t height = 2688;
+  size_t bytesPerRow = width * 4;
+  NSMutableData *pixels = [NSMutableData dataWithLength:bytesPerRow * height];
+  arc4random_buf(pixels.mutableBytes, pixels.length);
+  NSMutableData *hashes = [NSMutableData dataWithLength:FBTilesCount(width, height, 32) * sizeof(uint64_t)];
+  [self measureBlock:^{
+    FBComputeTileHashes(pixels.bytes, width, height, bytesPerRow, 32, hashes.mutableBytes);
+  }];
+}
+
+@end
@@ -0,0 +1,87 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <XCTest/XCTest.h>
+
+#import "FBTrace.h"
+
+@interface FBTraceTests : XCTestCase
+@end
+
+@implementation FBTraceTests
+
+- (void)setUp
+{
+  [super setUp];
+  [FBTrace clear];
+}
+
+- (void)tearDown
+{
+  FBTraceSetCurrentRequestID(0);
+  [super tearDown];
+}
+
+- (void)testEmptyTrace
+{
+  NSDictionary *trace = [FBTrace chromeTraceEvents];
+  XCTAssertEqualObjects(trace[@"traceEvents"], @[]);
+  XCTAssertTrue([NSJSONSerialization isValidJSONObject:trace]);
+}
+
+- (void)testSpansAreRecorded
+{
+  FBTraceBegin("outer");
+  FBTraceBegin("inner");
+  FBTraceEnd("inner");
+  FBTraceEnd("outer");
+  NSArray<NSDictionary *> *events = [FBTrace chromeTraceEvents][@"traceEvents"];
+  XCTAssertEqual(events.count, 4);
+  NSArray *names = [events valueForKey:@"name"];
+  NSArray *expectedNames = @[@"outer", @"inner", @"inner", @"outer"];
+  XCTAssertEqualObjects(names, expectedNames);
+  NSArray *phases = [events valueForKey:@"ph"];
+  NSArray *expectedPhases = @[@"B", @"B", @"E", @"E"];
+  XCTAssertEqualObjects(phases, expectedPhases);
+  XCTAssertLessThanOrEqual([events.firstObject[@"ts"] doubleValue], [events.lastObject[@"ts"] doubleValue]);
+  XCTAssertEqualObjects(events.firstObject[@"tid"], events.lastObject[@"tid"]);
+  XCTAssertNil(events.firstObject[@"args"]);
+}
+
+- (void)testRequestIdentifierIsAttached
+{
+  uint64_t requestID = FBTraceNextRequestID();
+  XCTAssertGreaterThan(FBTraceNextRequestID(), requestID);
+  FBTraceSetCurrentRequestID(requestID);
+  FBTraceBegin("request");
+  FBTraceEnd("request");
+  NSArray<NSDictionary *> *events = [FBTrace chromeTraceEvents][@"traceEvents"];
+  XCTAssertEqualObjects(events.firstObject[@"args"][@"requestId"], @(requestID));
+}
+
+- (void)testInternedNamesAreStable
+{
+  NSString *name = [NSMutableString stringWithString:@"GET /status"];
+  const char *internedName = FBTraceInternName(name);
+  XCTAssertEqual(internedName, FBTraceInternName(@"GET /status"));
+  XCTAssertEqual(strcmp(internedName, "GET /status"), 0);
+}
+
+- (void)testRingBufferKeepsMostRecentEvents
+{
+  for (NSUInteger index = 0; index < 40000; index++) {
+    FBTraceBegin("old");
+  }
+  FBTraceBegin("recent");
+  NSArray<NSDictionary *> *events = [FBTrace chromeTraceEvents][@"traceEvents"];
+  XCTAssertEqual(events.count, 32768);
+  XCTAssertEqualObjects(events.lastObject[@"name"], @"recent");
+}
+
+@end
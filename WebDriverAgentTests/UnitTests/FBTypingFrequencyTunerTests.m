@@ -0,0 +1,177 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <XCTest/XCTest.h>
+
+#import "FBTypingFrequencyTuner.h"
+
+@interface FBTypingFrequencyTunerTests : XCTestCase
+@property (nonatomic, strong) FBTypingFrequencyTuner *tuner;
+@end
+
+@implementation FBTypingFrequencyTunerTests
+
+- (void)setUp
+{
+  [super setUp];
+  self.tuner = [[FBTypingFrequencyTuner alloc] initWithMinimumFrequency:60 maximumFrequency:480];
+}
+
+- (void)testStartsWithMaximumFrequency
+{
+  XCTAssertEqual(self.tuner.frequency, 480);
+}
+
+- (void)testFailureHalvesFrequency
+{
+  [self.tuner reportTypedCharactersCount:10 atFrequency:480 succeeded:NO];
+  XCTAssertEqual(self.tuner.frequency, 240);
+  [self.tuner reportTypedCharactersCount:10 atFrequency:240 succeeded:NO];
+  XCTAssertEqual(self.tuner.frequency, 120);
+  XCTAssertEqual(self.tuner.failedAttemptsCount, 2);
+  XCTAssertEqual(self.tuner.typedCharactersCount, 20);
+}
+
+- (void)testFrequencyIsNotLoweredBelowMinimum
+{
+  for (NSUInteger i = 0; i < 10; i++) {
+    [self.tuner reportTypedCharactersCount:10 atFrequency:self.tuner.frequency succeeded:NO];
+  }
+  XCTAssertEqual(self.tuner.frequency, 60);
+}
+
+- (void)testSeveralSuccessesRaiseFrequency
+{
+  [self.tuner reportTypedCharactersCount:10 atFrequency:480 succeeded:NO];
+  [self.tuner reportTypedCharactersCount:10 atFrequency:240 succeeded:YES];
+  [self.tuner reportTypedCharactersCount:10 atFrequency:240 succeeded:YES];
+  XCTAssertEqual(self.tuner.frequency, 240);
+  [self.tuner reportTypedCharactersCount:10 atFrequency:240 succeeded:YES];
+  XCTAssertEqual(self.tuner.frequency, 300);
+}
+
+- (void)testFrequencyIsNotRaisedAboveMaximum
+{
+  for (NSUInteger i = 0; i < 10; i++) {
+    [self.tuner reportTypedCharactersCount:10 atFrequency:self.tuner.frequency succeeded:YES];
+  }
+  XCTAssertEqual(self.tuner.frequency, 480);
+}
+
+- (void)testShortOrSlowInputsDoNotRaiseFrequency
+{
+  [self.tuner reportTypedCharactersCount:10 atFrequency:480 succeeded:NO];
+  for (NSUInteger i = 0; i < 5; i++) {
+    [self.tuner reportTypedCharactersCount:1 atFrequency:240 succeeded:YES];
+    [self.tuner reportTypedCharactersCount:10 atFrequency:60 succeeded:YES];
+  }
+  XCTAssertEqual(self.tuner.frequency, 240);
+}
+
+- (void)testTypingSucceedsAfterRetypingDroppedSuffix
+{
+  NSMutableString *field = [NSMutableString stringWithString:@"abc"];
+  NSMutableArray<NSNumber *> *frequencies = [NSMutableArray array];
+  NSError *error;
+  BOOL result = [self.tuner typeText:@"defghi" afterText:field.copy minimumFrequency:60 attempts:3 typer:^BOOL(NSString *text, NSUInteger frequency, BOOL shouldReplaceValue, NSError **typingError) {
+    [frequencies addObject:@(frequency)];
+    // The first attempt drops the last three characters
+    [field appendString:1 == frequencies.count ? [text substringToIndex:3] : text];
+    return YES;
+  } textReader:^NSString *{
+    return field.copy;
+  } error:&error];
+  XCTAssertTrue(result);
+  XCTAssertNil(error);
+  XCTAssertEqualObjects(field, @"abcdefghi");
+  XCTAssertEqualObjects(frequencies, (@[@480, @240]));
+}
+
+- (void)testWholeTextIsRetypedIfCharacterIsDroppedInTheMiddle
+{
+  NSMutableString *field = [NSMutableString stringWithString:@"abc"];
+  NSMutableArray<NSNumber *> *frequencies = [NSMutableArray array];
+  NSError *error;
+  BOOL result = [self.tuner typeText:@"defghi" afterText:field.copy minimumFrequency:60 attempts:3 typer:^BOOL(NSString *text, NSUInteger frequency, BOOL shouldReplaceValue, NSError **typingError) {
+    [frequencies addObject:@(frequency)];
+    if (shouldReplaceValue) {
+      [field setString:text];
+    } else {
+      // 'f' is dropped
+      [field appendString:[text stringByReplacingOccurrencesOfString:@"f" withString:@""]];
+    }
+    return YES;
+  } textReader:^NSString *{
+    return field.copy;
+  } error:&error];
+  XCTAssertTrue(result);
+  XCTAssertNil(error);
+  XCTAssertEqualObjects(field, @"abcdefghi");
+  XCTAssertEqualObjects(frequencies, (@[@480, @60]));
+}
+
+- (void)testTypingFailsIfTextDivergesAfterRetyping
+{
+  NSMutableString *field = [NSMutableString stringWithString:@"abc"];
+  __block NSUInteger attemptsCount = 0;
+  __block BOOL didReplaceValue = NO;
+  NSError *error;
+  BOOL result = [self.tuner typeText:@"def" afterText:field.copy minimumFrequency:60 attempts:3 typer:^BOOL(NSString *text, NSUInteger frequency, BOOL shouldReplaceValue, NSError **typingError) {
+    attemptsCount++;
+    didReplaceValue = didReplaceValue || shouldReplaceValue;
+    // Simulates autocorrection of the typed text
+    if (shouldReplaceValue) {
+      [field setString:@"abcxyz"];
+    } else {
+      [field appendString:@"xyz"];
+    }
+    return YES;
+  } textReader:^NSString *{
+    return field.copy;
+  } error:&error];
+  XCTAssertFalse(result);
+  XCTAssertNotNil(error);
+  XCTAssertEqual(attemptsCount, 2);
+  XCTAssertTrue(didReplaceValue);
+  XCTAssertTrue([error.localizedDescription containsString:@"'abcxyz'"]);
+  XCTAssertTrue([error.localizedDescription containsString:@"'abcdef'"]);
+}
+
+- (void)testTypingFailsIfAttemptsAreExhausted
+{
+  NSMutableArray<NSNumber *> *frequencies = [NSMutableArray array];
+  NSError *error;
+  BOOL result = [self.tuner typeText:@"def" afterText:@"abc" minimumFrequency:60 attempts:3 typer:^BOOL(NSString *text, NSUInteger frequency, BOOL shouldReplaceValue, NSError **typingError) {
+    // Every character is dropped
+    [frequencies addObject:@(frequency)];
+    return YES;
+  } textReader:^NSString *{
+    return @"abc";
+  } error:&error];
+  XCTAssertFalse(result);
+  XCTAssertNotNil(error);
+  XCTAssertEqualObjects(frequencies, (@[@480, @240, @60]));
+  XCTAssertTrue([error.localizedDescription containsString:@"'abcdef'"]);
+  XCTAssertTrue([error.localizedDescription containsString:@"got 'abc'"]);
+}
+
+- (void)testTypingErrorIsPropagated
+{
+  NSError *error;
+  BOOL result = [self.tuner typeText:@"def" afterText:@"" minimumFrequency:60 attempts:3 typer:^BOOL(NSString *text, NSUInteger frequency, BOOL shouldReplaceValue, NSError **typingError) {
+    *typingError = [NSError errorWithDomain:@"test" code:1 userInfo:nil];
+    return NO;
+  } textReader:^NSString *{
+    return @"";
+  } error:&error];
+  XCTAssertFalse(result);
+  XCTAssertEqualObjects(error.domain, @"test");
+}
+
+@end
@@ -0,0 +1,210 @@
+/**
+ * Copyright (c) 2015-present, Facebook, Inc.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree. An additional grant
+ * of patent rights can be found in the PATENTS file in the same directory.
+ */
+
+#import <UIKit/UIKit.h>
+#import <XCTest/XCTest.h>
+
+#import "FBW3CActionsCompiler.h"
+
+@interface FBW3CActionsCompilerTests : XCTestCase
+@property (nonatomic, copy) FBW3CActionsElementCenterResolver resolver;
+@end
+
+@implementation FBW3CActionsCompilerTests
+
+- (void)setUp
+{
+  [super setUp];
+  self.resolver = ^NSValue *(NSString *elementUUID) {
+    return [elementUUID isEqualToString:@"existing"] ? [NSValue valueWithCGPoint:CGPointMake(100, 200)] : nil;
+  };
+}
+
+- (NSArray<FBW3CActionEventPath *> *)compile:(NSArray *)actions
+{
+  NSError *error;
+  NSArray<FBW3CActionEventPath *> *paths = [FBW3CActionsCompiler compileActions:actions elementCenterResolver:self.resolver error:&error];
+  XCTAssertNil(error);
+  return paths;
+}
+
+- (void)assertCompilationFails:(NSArray *)actions
+{
+  NSError *error;
+  XCTAssertNil([FBW3CActionsCompiler compileActions:actions elementCenterResolver:self.resolver error:&error]);
+  XCTAssertNotNil(error);
+}
+
+- (void)assertEvent:(FBW3CActionEvent *)event type:(FBW3CActionEventType)type offset:(NSTimeInterval)offset point:(CGPoint)point
+{
+  XCTAssertEqual(event.type, type);
+  XCTAssertEqualWithAccuracy(event.offset, offset, 0.0001);
+  XCTAssertEqualObjects([NSValue valueWithCGPoint:event.point], [NSValue valueWithCGPoint:point]);
+}
+
+- (void)testTap
+{
+  NSArray<FBW3CActionEventPath *> *paths = [self compile:@[
+    @{@"type": @"pointer", @"id": @"finger1", @"parameters": @{@"pointerType": @"touch"}, @"actions": @[
+      @{@"type": @"pointerMove", @"duration": @0, @"x": @10, @"y": @20},
+      @{@"type": @"pointerDown", @"button": @0},
+      @{@"type": @"pause", @"duration": @100},
+      @{@"type": @"pointerUp", @"button": @0},
+    ]},
+  ]];
+  XCTAssertEqual(paths.count, 1);
+  XCTAssertEqualObjects(paths.firstObject.sourceId, @"finger1");
+  XCTAssertFalse(paths.firstObject.isKeyPath);
+  NSArray<FBW3CActionEvent *> *events = paths.firstObject.events;
+  XCTAssertEqual(events.count, 2);
+  [self assertEvent:events[0] type:FBW3CActionEventTypePointerDown offset:0 point:CGPointMake(10, 20)];
+  [self assertEvent:events[1] type:FBW3CActionEventTypePointerUp offset:0.1 point:CGPointMake(10, 20)];
+}
+
+- (void)testSwipeWithRelativeMoves
+{
+  NSArray<FBW3CActionEventPath *> *paths = [self compile:@[
+    @{@"type": @"pointer", @"id": @"finger1", @"actions": @[
+      @{@"type": @"pointerMove", @"x": @10, @"y": @20},
+      @{@"type": @"pointerDown"},
+      @{@"type": @"pointerMove", @"duration": @500, @"origin": @"pointer", @"x": @0, @"y": @100},
+      @{@"type": @"pointerMove", @"duration": @250, @"origin": @"pointer", @"x": @50, @"y": @0},
+      @{@"type": @"pointerUp"},
+    ]},
+  ]];
+  XCTAssertEqual(paths.count, 1);
+  NSArray<FBW3CActionEvent *> *events = paths.firstObject.events;
+  XCTAssertEqual(events.count, 4);
+  [self assertEvent:events[0] type:FBW3CActionEventTypePointerDown offset:0 point:CGPointMake(10, 20)];
+  [self assertEvent:events[1] type:FBW3CActionEventTypePointerMove offset:0.5 point:CGPointMake(10, 120)];
+  [self assertEvent:events[2] type:FBW3CActionEventTypePointerMove offset:0.75 point:CGPointMake(60, 120)];
+  [self assertEvent:events[3] type:FBW3CActionEventTypePointerUp offset:0.75 point:CGPointMake(60, 120)];
+}
+
+- (void)testMultiplePointersShareTicks
+{
+  NSArray<FBW3CActionEventPath *> *paths = [self compile:@[
+    @{@"type": @"pointer", @"id": @"finger1", @"actions": @[
+      @{@"type": @"pointerMove", @"x": @100, @"y": @100},
+      @{@"type": @"pointerDown"},
+      @{@"type": @"pointerMove", @"duration": @200, @"x": @50, @"y": @50},
+      @{@"type": @"pointerUp"},
+    ]},
+    @{@"type": @"pointer", @"id": @"finger2", @"actions": @[
+      @{@"type": @"pointerMove", @"x": @200, @"y": @200},
+      @{@"type": @"pointerDown"},
+      @{@"type": @"pointerMove", @"duration": @400, @"x": @250, @"y": @250},
+      @{@"type": @"pointerUp"},
+    ]},
+  ]];
+  XCTAssertEqual(paths.count, 2);
+  XCTAssertEqualObjects(paths[0].sourceId, @"finger1");
+  XCTAssertEqualObjects(paths[1].sourceId, @"finger2");
+  // The tick lasts as long as its longest action
+  [self assertEvent:paths[0].events[1] type:FBW3CActionEventTypePointerMove offset:0.2 point:CGPointMake(50, 50)];
+  [self assertEvent:paths[0].events[2] type:FBW3CActionEventTypePointerUp offset:0.4 point:CGPointMake(50, 50)];
+  [self assertEvent:paths[1].events[1] type:FBW3CActionEventTypePointerMove offset:0.4 point:CGPointMake(250, 250)];
+  [self assertEvent:paths[1].events[2] type:FBW3CActionEventTypePointerUp offset:0.4 point:CGPointMake(250, 250)];
+}
+
+- (void)testElementOrigin
+{
+  NSArray<FBW3CActionEventPath *> *paths = [self compile:@[
+    @{@"type": @"pointer", @"id": @"finger1", @"actions": @[
+      @{@"type": @"pointerMove", @"origin": @{@"element-6066-11e4-a52e-4f735466cecf": @"existing"}, @"x": @5, @"y": @-5},
+      @{@"type": @"pointerDown"},
+      @{@"type": @"pointerUp"},
+    ]},
+  ]];
+  [self assertEvent:paths.firstObject.events.firstObject type:FBW3CActionEventTypePointerDown offset:0 point:CGPointMake(105, 195)];
+}
+
+- (void)testMissingElementOrigin
+{
+  [self assertCompilationFails:@[
+    @{@"type": @"pointer", @"id": @"finger1", @"actions": @[
+      @{@"type": @"pointerMove", @"origin": @{@"ELEMENT": @"missing"}},
+    ]},
+  ]];
+}
+
+- (void)testPressedPointerIsReleasedAfterLastTick
+{
+  NSArray<FBW3CActionEventPath *> *paths = [self compile:@[
+    @{@"type": @"pointer", @"id": @"finger1", @"actions": @[
+      @{@"type": @"pointerDown"},
+      @{@"type": @"pause", @"duration": @300},
+    ]},
+  ]];
+  XCTAssertEqual(paths.firstObject.events.count, 2);
+  [self assertEvent:paths.firstObject.events.lastObject type:FBW3CActionEventTypePointerUp offset:0.3 point:CGPointZero];
+}
+
+- (void)testPointerWithoutPressProducesNoPaths
+{
+  NSArray<FBW3CActionEventPath *> *paths = [self compile:@[
+    @{@"type": @"pointer", @"id": @"finger1", @"actions": @[
+      @{@"type": @"pointerMove", @"duration": @100, @"x": @10, @"y": @10},
+      @{@"type": @"pointerUp"},
+    ]},
+    @{@"type": @"none", @"id": @"none1", @"actions": @[
+      @{@"type": @"pause", @"duration": @100},
+    ]},
+  ]];
+  XCTAssertEqual(paths.count, 0);
+}
+
+- (void)testKeys
+{
+  NSArray<FBW3CActionEventPath *> *paths = [self compile:@[
+    @{@"type": @"key", @"id": @"keyboard", @"actions": @[
+      @{@"type": @"keyDown", @"value": @"\uE008"},
+      @{@"type": @"keyDown", @"value": @"a"},
+      @{@"type": @"keyUp", @"value": @"a"},
+      @{@"type": @"keyUp", @"value": @"\uE008"},
+      @{@"type": @"pause", @"duration": @100},
+      @{@"type": @"keyDown", @"value": @"\uE003"},
+      @{@"type": @"keyDown", @"value": @"\uE007"},
+    ]},
+  ]];
+  XCTAssertEqual(paths.count, 1);
+  XCTAssertTrue(paths.firstObject.isKeyPath);
+  NSArray<FBW3CActionEvent *> *events = paths.firstObject.events;
+  XCTAssertEqual(events.count, 3);
+  XCTAssertEqualObjects(events[0].value, @"a");
+  XCTAssertEqualObjects(events[1].value, @"\b");
+  XCTAssertEqualWithAccuracy(events[1].offset, 0.1, 0.0001);
+  XCTAssertEqualObjects(events[2].value, @"\n");
+}
+
+- (void)testUnsupportedKey
+{
+  [self assertCompilationFails:@[
+    @{@"type": @"key", @"id": @"keyboard", @"actions": @[
+      @{@"type": @"keyDown", @"value": @"\uE031"},
+    ]},
+  ]];
+}
+
+- (void)testInvalidInput
+{
+  [self assertCompilationFails:(NSArray *)@{}];
+  [self assertCompilationFails:@[@{@"type": @"pointer", @"actions": @[]}]];
+  [self assertCompilationFails:@[
+    @{@"type": @"pointer", @"id": @"finger1", @"actions": @[]},
+    @{@"type": @"pointer", @"id": @"finger1", @"actions": @[]},
+  ]];
+  [self assertCompilationFails:@[@{@"type": @"wheel", @"id": @"wheel1", @"actions": @[]}]];
+  [self assertCompilationFails:@[@{@"type": @"pointer", @"id": @"mouse", @"parameters": @{@"pointerType": @"mouse"}, @"actions": @[]}]];
+  [self assertCompilationFails:@[@{@"type": @"pointer", @"id": @"finger1", @"actions": @[@{@"type": @"keyDown", @"value": @"a"}]}]];
+  [self assertCompilationFails:@[@{@"type": @"pointer", @"id": @"finger1", @"actions": @[@{@"type": @"pause", @"duration": @-1}]}]];
+  [self assertCompilationFails:@[@{@"type": @"key", @"id": @"keyboard", @"actions": @[@{@"type": @"keyDown", @"value": @"ab"}]}]];
+}
+
+@end